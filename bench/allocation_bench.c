@@ -0,0 +1,88 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../include/allocator.h"
+#include "../include/arena.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+#include "../include/picutils.h"
+
+/*
+ * Reports the number of allocations and allocated bytes of every allocating verb, with and without an arena.
+ */
+
+#define ALLOCATION_BENCH_ITERATIONS 1000
+
+/**
+ * Prints the allocation rate of a single verb.
+ * @param name The name of the measured verb.
+ * @param counter The counter that was installed while the verb ran.
+ */
+static void allocation_report(const char *name, const bstd_allocation_counter *counter) {
+    printf("%-48s %10.2f allocs/op %10.2f bytes/op\n", name,
+           (double) counter->allocations / ALLOCATION_BENCH_ITERATIONS,
+           (double) counter->bytes / ALLOCATION_BENCH_ITERATIONS);
+}
+
+int main(void) {
+
+    bstd_number a = { .value = 12345, .scale = 2, .length = 9, .isSigned = true, .positive = true };
+    bstd_number b = { .value = 678, .scale = 1, .length = 9, .isSigned = true, .positive = false };
+    bstd_picture *picture = bstd_create_picture("XX9");
+    bstd_allocation_counter counter;
+
+#define MEASURE(name, expr) \
+    do { \
+        bstd_allocation_counter_init(&counter); \
+        bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter); \
+        for (int i = 0; i < ALLOCATION_BENCH_ITERATIONS; ++i) { \
+            void *p = (void *) (expr); \
+            bench_clobber(p); \
+            bstd_free(p); \
+        } \
+        bstd_set_allocator(NULL, NULL, NULL, NULL); \
+        allocation_report(name, &counter); \
+    } while (0)
+
+    MEASURE("bstd_number_from_int", bstd_number_from_int(42, 9, true));
+    MEASURE("bstd_sum", bstd_sum(&a, &b));
+    MEASURE("bstd_product", bstd_product(&a, &b));
+    MEASURE("bstd_quotient", bstd_quotient(&a, &b));
+    MEASURE("bstd_number_to_cstr", bstd_number_to_cstr(a));
+    MEASURE("bstd_picture_to_cstr", bstd_picture_to_cstr(picture));
+
+#undef MEASURE
+
+    // an arena allocates one chunk up front and nothing per operation
+    bstd_allocation_counter_init(&counter);
+    bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter);
+    bstd_arena arena;
+    bstd_arena_init(&arena, 0);
+    for (int i = 0; i < ALLOCATION_BENCH_ITERATIONS; ++i) {
+        bench_clobber(bstd_sum_arena(&arena, &a, &b));
+        bstd_arena_reset(&arena);
+    }
+    bstd_arena_destroy(&arena);
+    bstd_set_allocator(NULL, NULL, NULL, NULL);
+    allocation_report("bstd_sum_arena (reset per op)", &counter);
+
+    // an OCCURS table of PIC X(40) pictures: the interned mask is allocated once, by the first picture
+    char occurs_mask[41];
+    memset(occurs_mask, BSTD_MASK_X, 40);
+    occurs_mask[40] = '\0';
+    static bstd_picture *occurs[ALLOCATION_BENCH_ITERATIONS];
+    bstd_allocation_counter_init(&counter);
+    bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter);
+    for (int i = 0; i < ALLOCATION_BENCH_ITERATIONS; ++i) {
+        occurs[i] = bstd_create_picture(occurs_mask);
+    }
+    for (int i = 0; i < ALLOCATION_BENCH_ITERATIONS; ++i) {
+        bstd_free(occurs[i]);
+    }
+    bstd_set_allocator(NULL, NULL, NULL, NULL);
+    allocation_report("bstd_create_picture X(40) (OCCURS)", &counter);
+
+    bstd_free(picture);
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include "bench.h"
+
+#define BENCH_TABLE_SIZE 100000
+#define BENCH_TABLE_PASSES 100
+#include "../include/allocator.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+#include "../include/columnutils.h"
+
+/**
+ * The allocating ADD lowering as it was before bstd_add became heap-free:
+ * a temporary sum is allocated, assigned and released for every addition.
+ */
+static void add_via_sum(bstd_number *lhs, const bstd_number *rhs) {
+    bstd_number *sum = bstd_sum(lhs, rhs);
+    bstd_assign_number(lhs, sum);
+    bstd_free(sum);
+}
+
+int main(void) {
+
+    // ADD 1 TO COUNTER, with COUNTER PICTURE IS 9(9)
+    const bstd_number one = { .value = 1, .scale = 0, .length = 1, .isSigned = false, .positive = true };
+    bstd_number counter = { .value = 0, .scale = 0, .length = 9, .isSigned = false, .positive = true };
+    uint64_t start;
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        add_via_sum(&counter, &one);
+        bench_clobber(&counter);
+    }
+    bench_report("ADD (bstd_sum + bstd_assign_number + bstd_free)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        bstd_add(&counter, &one);
+        bench_clobber(&counter);
+    }
+    bench_report("ADD (bstd_add)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    // MULTIPLY RATE BY AMOUNT, with RATE PICTURE IS S9(5)V9(4) and AMOUNT PICTURE IS S9(9)V99
+    const bstd_number rate = { .value = 123456789, .scale = 4, .length = 9, .isSigned = true, .positive = true };
+    const bstd_number amount = { .value = 98765432101, .scale = 2, .length = 11, .isSigned = true, .positive = false };
+    bstd_number target;
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        target = amount;
+        bstd_assign_double(&target, bstd_number_to_double(&target) * bstd_number_to_double(&rate));
+        bench_clobber(&target);
+    }
+    bench_report("MULTIPLY (through double)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        target = amount;
+        bstd_multiply(&target, &rate);
+        bench_clobber(&target);
+    }
+    bench_report("MULTIPLY (bstd_multiply)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    // DIVIDE 12 INTO MONTHLY, with MONTHLY PICTURE IS S9(9)V99
+    const bstd_number twelve = { .value = 12, .scale = 0, .length = 2, .isSigned = false, .positive = true };
+    const bstd_number yearly = { .value = 12345678901, .scale = 2, .length = 11, .isSigned = true, .positive = true };
+    bstd_divisor by_twelve;
+    bstd_divisor_init(&by_twelve, &twelve);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        target = yearly;
+        target.value += i;
+        bstd_assign_double(&target, bstd_number_to_double(&target) / bstd_number_to_double(&twelve));
+        bench_clobber(&target);
+    }
+    bench_report("DIVIDE (through double)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        target = yearly;
+        target.value += i;
+        bstd_divide(&target, &twelve);
+        bench_clobber(&target);
+    }
+    bench_report("DIVIDE (bstd_divide)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        target = yearly;
+        target.value += i;
+        bstd_divide_by(&target, &by_twelve);
+        bench_clobber(&target);
+    }
+    bench_report("DIVIDE (bstd_divide_by, prepared divisor)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    // ADD AMOUNTS(I) TO TOTALS(I) over OCCURS 100000 TIMES PIC S9(7)V99
+    bstd_number *totals = malloc(sizeof(bstd_number) * BENCH_TABLE_SIZE);
+    bstd_number *amounts = malloc(sizeof(bstd_number) * BENCH_TABLE_SIZE);
+    for (int i = 0; i < BENCH_TABLE_SIZE; ++i) {
+        totals[i] = (bstd_number) { .value = (uint64_t) i * 7919 % 1000000000, .scale = 2, .length = 9, .isSigned = true, .positive = true };
+        amounts[i] = (bstd_number) { .value = (uint64_t) i * 104729 % 100000, .scale = 2, .length = 5, .isSigned = true, .positive = i % 3 != 0 };
+    }
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < BENCH_TABLE_PASSES; ++pass) {
+        for (int i = 0; i < BENCH_TABLE_SIZE; ++i) {
+            bstd_add(&totals[i], &amounts[i]);
+        }
+        bench_clobber(totals);
+    }
+    bench_report("ADD table (bstd_add per element)", start, bench_now_ns(), (uint64_t) BENCH_TABLE_SIZE * BENCH_TABLE_PASSES);
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < BENCH_TABLE_PASSES; ++pass) {
+        bstd_add_n(totals, amounts, BENCH_TABLE_SIZE);
+        bench_clobber(totals);
+    }
+    bench_report("ADD table (bstd_add_n)", start, bench_now_ns(), (uint64_t) BENCH_TABLE_SIZE * BENCH_TABLE_PASSES);
+
+    // the same table, stored as columns
+    bstd_number_column *total_column = bstd_create_number_column(BENCH_TABLE_SIZE, 9, 2, true);
+    bstd_number_column *amount_column = bstd_create_number_column(BENCH_TABLE_SIZE, 5, 2, true);
+    for (int i = 0; i < BENCH_TABLE_SIZE; ++i) {
+        bstd_number_column_set(total_column, i, &totals[i]);
+        bstd_number_column_set(amount_column, i, &amounts[i]);
+    }
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < BENCH_TABLE_PASSES; ++pass) {
+        bstd_number_column_add(total_column, amount_column);
+        bench_clobber(total_column);
+    }
+    bench_report("ADD table (bstd_number_column_add)", start, bench_now_ns(), (uint64_t) BENCH_TABLE_SIZE * BENCH_TABLE_PASSES);
+
+    // ADD AMOUNT(I) TO TOTAL for every record, with TOTAL PICTURE IS S9(15)V99
+    bstd_number total = { .value = 0, .scale = 2, .length = 17, .isSigned = true, .positive = true };
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < BENCH_TABLE_PASSES; ++pass) {
+        for (int i = 0; i < BENCH_TABLE_SIZE; ++i) {
+            bstd_add(&total, &amounts[i]);
+        }
+        bench_clobber(&total);
+    }
+    bench_report("ADD into one total (bstd_add)", start, bench_now_ns(), (uint64_t) BENCH_TABLE_SIZE * BENCH_TABLE_PASSES);
+
+    bstd_accumulator accumulator;
+    bstd_accumulator_init(&accumulator, &total);
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < BENCH_TABLE_PASSES; ++pass) {
+        for (int i = 0; i < BENCH_TABLE_SIZE; ++i) {
+            bstd_accumulator_add(&accumulator, &amounts[i]);
+        }
+        bench_clobber(&accumulator);
+    }
+    bstd_accumulator_store(&accumulator, &total);
+    bench_report("ADD into one total (bstd_accumulator_add)", start, bench_now_ns(), (uint64_t) BENCH_TABLE_SIZE * BENCH_TABLE_PASSES);
+
+    free(totals);
+    free(amounts);
+    bstd_free(total_column);
+    bstd_free(amount_column);
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef BSTD_BENCH_ITERATIONS
+#define BSTD_BENCH_ITERATIONS 10000000
+#endif
+
+/**
+ * Gets a monotonic timestamp in nanoseconds.
+ * @return Returns the current value of the monotonic clock in nanoseconds.
+ */
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * Prevents the compiler from optimizing away the computation that produced the specified memory.
+ * @param p The memory that must be considered observed.
+ */
+static inline void bench_clobber(const void *p) {
+    __asm__ volatile("" : : "g"(p) : "memory");
+}
+
+/**
+ * Prints a single benchmark result line.
+ * @param name The name of the measured operation.
+ * @param start_ns The timestamp at which the measurement started.
+ * @param end_ns The timestamp at which the measurement ended.
+ * @param ops The number of operations performed between start_ns and end_ns.
+ */
+static inline void bench_report(const char *name, uint64_t start_ns, uint64_t end_ns, uint64_t ops) {
+    printf("%-48s %10.2f ns/op\n", name, (double) (end_ns - start_ns) / (double) ops);
+}
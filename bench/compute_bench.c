@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "../include/allocator.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+#include "../include/compute.h"
+
+int main(void) {
+
+    // COMPUTE X = (A + B) * C - D / E, with X PICTURE IS S9(9)V99
+    const bstd_number a = { .value = 12345, .scale = 2, .length = 7, .isSigned = true, .positive = true };
+    const bstd_number b = { .value = 678, .scale = 1, .length = 5, .isSigned = true, .positive = false };
+    const bstd_number c = { .value = 3, .scale = 0, .length = 3, .isSigned = false, .positive = true };
+    const bstd_number d = { .value = 100000, .scale = 2, .length = 9, .isSigned = true, .positive = true };
+    const bstd_number e = { .value = 7, .scale = 0, .length = 2, .isSigned = false, .positive = true };
+    bstd_number x = { .value = 0, .scale = 2, .length = 11, .isSigned = true, .positive = true };
+    uint64_t start;
+
+    // the chain of allocating calls a compiler emits today
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        bstd_number *sum = bstd_sum(&a, &b);
+        bstd_number *product = bstd_product(sum, &c);
+        bstd_number *quotient = bstd_quotient(&d, &e);
+        bstd_number *difference = bstd_difference(product, quotient);
+        bstd_assign_number(&x, difference);
+        bstd_free(sum);
+        bstd_free(product);
+        bstd_free(quotient);
+        bstd_free(difference);
+        bench_clobber(&x);
+    }
+    bench_report("COMPUTE (bstd_sum/product/quotient/difference)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    const bstd_expression na = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression nb = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression nc = { BSTD_EXPRESSION_OPERAND, 2, NULL, NULL };
+    const bstd_expression nd = { BSTD_EXPRESSION_OPERAND, 3, NULL, NULL };
+    const bstd_expression ne = { BSTD_EXPRESSION_OPERAND, 4, NULL, NULL };
+    const bstd_expression sum = { BSTD_EXPRESSION_ADD, 0, &na, &nb };
+    const bstd_expression product = { BSTD_EXPRESSION_MULTIPLY, 0, &sum, &nc };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &nd, &ne };
+    const bstd_expression root = { BSTD_EXPRESSION_SUBTRACT, 0, &product, &quotient };
+    bstd_program *program = bstd_compute_compile(&root);
+    const bstd_number *operands[] = { &a, &b, &c, &d, &e };
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        bstd_compute(program, operands, &x);
+        bench_clobber(&x);
+    }
+    bench_report("COMPUTE (bstd_compute)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    bstd_free(program);
+
+    return 0;
+}
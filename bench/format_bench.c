@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "../include/allocator.h"
+#include "../include/numutils.h"
+
+int main(void) {
+
+    // DISPLAY AMOUNT, with AMOUNT PICTURE IS S9(9)V99
+    bstd_number amount = { .value = 98765432101, .scale = 2, .length = 11, .isSigned = true, .positive = false };
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    uint64_t start;
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        amount.value = 98765432101 + (uint64_t) i;
+        char *str = bstd_number_to_cstr(amount);
+        bench_clobber(str);
+        bstd_free(str);
+    }
+    bench_report("DISPLAY S9(9)V99 (bstd_number_to_cstr)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        amount.value = 98765432101 + (uint64_t) i;
+        bstd_number_format_into(buf, sizeof(buf), &amount);
+        bench_clobber(buf);
+    }
+    bench_report("DISPLAY S9(9)V99 (bstd_number_format_into)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    // DISPLAY COUNTER, with COUNTER PICTURE IS 9(9)
+    bstd_number counter = { .value = 0, .scale = 0, .length = 9, .isSigned = false, .positive = true };
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        counter.value = (uint64_t) i;
+        char *str = bstd_number_to_cstr(counter);
+        bench_clobber(str);
+        bstd_free(str);
+    }
+    bench_report("DISPLAY 9(9) (bstd_number_to_cstr)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BSTD_BENCH_ITERATIONS; ++i) {
+        counter.value = (uint64_t) i;
+        bstd_number_format_into(buf, sizeof(buf), &counter);
+        bench_clobber(buf);
+    }
+    bench_report("DISPLAY 9(9) (bstd_number_format_into)", start, bench_now_ns(), BSTD_BENCH_ITERATIONS);
+
+    return 0;
+}
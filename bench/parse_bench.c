@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "../include/numutils.h"
+
+#define BENCH_FIELD_WIDTH 12
+#define BENCH_FIELD_COUNT 1000
+
+int main(void) {
+
+    // a column of PICTURE IS S9(9)V99 values, as fixed-width text
+    static char data[BENCH_FIELD_WIDTH * BENCH_FIELD_COUNT + 1];
+    for (int i = 0; i < BENCH_FIELD_COUNT; ++i) {
+        snprintf(data + i * BENCH_FIELD_WIDTH, BENCH_FIELD_WIDTH + 1, "%12.2f", (i % 2 ? -1 : 1) * (1234567.89 + i));
+    }
+
+    static bstd_number numbers[BENCH_FIELD_COUNT];
+    for (int i = 0; i < BENCH_FIELD_COUNT; ++i) {
+        numbers[i] = (bstd_number) { .value = 0, .scale = 2, .length = 11, .isSigned = true, .positive = true };
+    }
+
+    const int passes = BSTD_BENCH_ITERATIONS / BENCH_FIELD_COUNT;
+    char field[BENCH_FIELD_WIDTH + 1];
+    uint64_t start;
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (int i = 0; i < BENCH_FIELD_COUNT; ++i) {
+            memcpy(field, data + i * BENCH_FIELD_WIDTH, BENCH_FIELD_WIDTH);
+            field[BENCH_FIELD_WIDTH] = '\0';
+            bstd_assign_double(&numbers[i], strtod(field, NULL));
+        }
+        bench_clobber(numbers);
+    }
+    bench_report("PARSE S9(9)V99 (strtod + bstd_assign_double)", start, bench_now_ns(), (uint64_t) passes * BENCH_FIELD_COUNT);
+
+    start = bench_now_ns();
+    for (int pass = 0; pass < passes; ++pass) {
+        bstd_number_parse_n(numbers, data, BENCH_FIELD_WIDTH, BENCH_FIELD_COUNT);
+        bench_clobber(numbers);
+    }
+    bench_report("PARSE S9(9)V99 (bstd_number_parse_n)", start, bench_now_ns(), (uint64_t) passes * BENCH_FIELD_COUNT);
+
+    return 0;
+}
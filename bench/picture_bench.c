@@ -0,0 +1,134 @@
+#include <string.h>
+#include "bench.h"
+#include "../include/allocator.h"
+#include "../include/arena.h"
+#include "../include/picutils.h"
+
+/*
+ * Customer name and address records: X(30)9(8)A(10), repeated up to 192 bytes.
+ */
+#define RECORD_MASK "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXX99999999AAAAAAAAAA"
+
+/**
+ * The picture kernels this build dispatches to. run.sh also builds this bench with BSTD_NO_SIMD, so that every row can be
+ * compared against the scalar kernels.
+ */
+#ifdef BSTD_NO_SIMD
+#define BENCH_KERNELS "scalar"
+#else
+#define BENCH_KERNELS "SIMD"
+#endif
+
+/**
+ * The picture sizes of the stress tests, from 5 to 255 bytes.
+ */
+static const uint8_t sizes[] = { 5, 16, 31, 64, 100, 200, 255 };
+
+/**
+ * Measures rendering and assigning a picture of a single mask, at every size.
+ * @param mask The mask character of every byte of the picture.
+ * @param iterations The number of operations to measure per size.
+ */
+static void bench_sizes(char mask, int iterations) {
+
+    char mask_str[256];
+    char str[256];
+    char name[64];
+    unsigned char key[255];
+    bstd_arena arena;
+    uint64_t start;
+
+    bstd_arena_init(&arena, 0);
+
+    for (size_t s = 0; s < sizeof(sizes); ++s) {
+
+        memset(mask_str, mask, sizes[s]);
+        mask_str[sizes[s]] = '\0';
+        bstd_picture *picture = bstd_create_picture(mask_str);
+
+        for (int i = 0; i < sizes[s]; ++i) {
+            str[i] = (char) (mask == BSTD_MASK_9 ? '0' + i % 10 : 'a' + i % 26);
+        }
+        str[sizes[s]] = '\0';
+
+        start = bench_now_ns();
+        for (int i = 0; i < iterations; ++i) {
+            bstd_assign_str(picture, str);
+            bench_clobber(picture->bytes);
+        }
+        snprintf(name, sizeof(name), "MOVE literal TO %c(%d) (assign_str, " BENCH_KERNELS ")", mask, sizes[s]);
+        bench_report(name, start, bench_now_ns(), iterations);
+
+        start = bench_now_ns();
+        for (int i = 0; i < iterations; ++i) {
+            bench_clobber(bstd_picture_to_cstr_arena(&arena, picture));
+            bstd_arena_reset(&arena);
+        }
+        snprintf(name, sizeof(name), "DISPLAY %c(%d) (to_cstr_arena, " BENCH_KERNELS ")", mask, sizes[s]);
+        bench_report(name, start, bench_now_ns(), iterations);
+
+        start = bench_now_ns();
+        for (int i = 0; i < iterations; ++i) {
+            bstd_picture_sort_key(picture, key, sizes[s]);
+            bench_clobber(key);
+        }
+        snprintf(name, sizeof(name), "SORT KEY %c(%d) (picture_sort_key, " BENCH_KERNELS ")", mask, sizes[s]);
+        bench_report(name, start, bench_now_ns(), iterations);
+
+        bstd_free(picture);
+    }
+
+    bstd_arena_destroy(&arena);
+}
+
+int main(void) {
+
+    const int iterations = BSTD_BENCH_ITERATIONS / 10;
+    bstd_picture *customer = bstd_create_picture(RECORD_MASK RECORD_MASK RECORD_MASK RECORD_MASK);
+    bstd_picture *copy = bstd_create_picture(RECORD_MASK RECORD_MASK RECORD_MASK RECORD_MASK);
+    char str[4 * sizeof(RECORD_MASK)];
+    unsigned char key[4 * sizeof(RECORD_MASK)];
+    bstd_arena arena;
+    uint64_t start;
+
+    for (size_t i = 0; i + 1 < sizeof(str); ++i) {
+        str[i] = (char) ('0' + i % 43);
+    }
+    str[sizeof(str) - 1] = '\0';
+
+    start = bench_now_ns();
+    for (int i = 0; i < iterations; ++i) {
+        bstd_assign_str(customer, str);
+        bench_clobber(customer->bytes);
+    }
+    bench_report("MOVE literal TO X(30)9(8)A(10) x4 (assign_str, " BENCH_KERNELS ")", start, bench_now_ns(), iterations);
+
+    start = bench_now_ns();
+    for (int i = 0; i < iterations; ++i) {
+        bstd_assign_picture(copy, customer);
+        bench_clobber(copy->bytes);
+    }
+    bench_report("MOVE X(30)9(8)A(10) x4 (assign_picture, " BENCH_KERNELS ")", start, bench_now_ns(), iterations);
+
+    bstd_arena_init(&arena, 0);
+    start = bench_now_ns();
+    for (int i = 0; i < iterations; ++i) {
+        bench_clobber(bstd_picture_to_cstr_arena(&arena, customer));
+        bstd_arena_reset(&arena);
+    }
+    bench_report("DISPLAY X(30)9(8)A(10) x4 (to_cstr_arena, " BENCH_KERNELS ")", start, bench_now_ns(), iterations);
+    bstd_arena_destroy(&arena);
+
+    start = bench_now_ns();
+    for (int i = 0; i < iterations; ++i) {
+        bstd_picture_sort_key(customer, key, customer->length);
+        bench_clobber(key);
+    }
+    bench_report("SORT KEY X(30)9(8)A(10) x4 (picture_sort_key, " BENCH_KERNELS ")", start, bench_now_ns(), iterations);
+
+    bench_sizes(BSTD_MASK_9, iterations);
+    bench_sizes(BSTD_MASK_A, iterations);
+    bench_sizes(BSTD_MASK_X, iterations);
+
+    return 0;
+}
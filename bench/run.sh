@@ -0,0 +1,10 @@
+mkdir -p out
+for bench in ./*_bench.c; do
+  name=$(basename "$bench" .c)
+  gcc -O2 -o "out/$name" "$bench" ../src/*.c
+  "out/$name"
+done
+
+# the picture kernels once more without SIMD, to compare every picture size against the scalar kernels
+gcc -O2 -DBSTD_NO_SIMD -o out/picture_bench_scalar ./picture_bench.c ../src/*.c
+out/picture_bench_scalar
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * Allocates the specified number of bytes. Receives the context registered with the hook.
+ */
+typedef void* (*bstd_alloc_fn)(void *ctx, size_t size);
+
+/**
+ * Resizes the specified allocation to the specified number of bytes. Receives the context registered with the hook.
+ */
+typedef void* (*bstd_realloc_fn)(void *ctx, void *ptr, size_t size);
+
+/**
+ * Releases the specified allocation. Receives the context registered with the hook.
+ */
+typedef void (*bstd_free_fn)(void *ctx, void *ptr);
+
+/**
+ * A set of allocation hooks, together with the context passed to each of them.
+ */
+typedef struct bstd_allocator_t {
+    bstd_alloc_fn alloc;
+    bstd_realloc_fn realloc;
+    bstd_free_fn free;
+    void *ctx;
+} bstd_allocator;
+
+/**
+ * Allocation statistics gathered by the counting allocator.
+ * Allocations are forwarded to the allocator that was installed when the counter was initialized.
+ * Initialize instances with bstd_allocation_counter_init.
+ */
+typedef struct bstd_allocation_counter_t {
+    size_t allocations;
+    size_t reallocations;
+    size_t frees;
+    size_t bytes;
+    bstd_allocator parent;
+} bstd_allocation_counter;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Sets the allocator that every allocating function of the library uses, unless it allocates from an arena.
+ * Arenas initialized afterwards allocate their chunks with it as well.
+ * Set the allocator before creating any objects: memory must be released by the allocator that allocated it.
+ * Interned picture masks, which the library keeps until the program exits, are allocated with malloc instead.
+ * This function is not thread-safe.
+ * @param alloc The allocation hook, or NULL to restore malloc, realloc and free.
+ * @param realloc The reallocation hook.
+ * @param free The release hook.
+ * @param ctx The context passed to each of the hooks.
+ */
+void bstd_set_allocator(bstd_alloc_fn alloc, bstd_realloc_fn realloc, bstd_free_fn free, void *ctx);
+
+/**
+ * Gets the allocator that the library currently uses.
+ * @return Returns the current allocator.
+ */
+const bstd_allocator* bstd_get_allocator(void);
+
+/**
+ * Releases memory that a function of the library allocated without an arena, using the current allocator.
+ * @param ptr The memory to release. May be NULL.
+ */
+void bstd_free(void *ptr);
+
+/**
+ * Initializes the specified counter with zero counts, forwarding to the current allocator.
+ * Install it with bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, counter).
+ * @param counter The counter to initialize.
+ */
+void bstd_allocation_counter_init(bstd_allocation_counter *counter);
+
+/**
+ * The allocation hook of the counting allocator; ctx must be a bstd_allocation_counter.
+ */
+void* bstd_counting_alloc(void *ctx, size_t size);
+
+/**
+ * The reallocation hook of the counting allocator; ctx must be a bstd_allocation_counter.
+ */
+void* bstd_counting_realloc(void *ctx, void *ptr, size_t size);
+
+/**
+ * The release hook of the counting allocator; ctx must be a bstd_allocation_counter.
+ */
+void bstd_counting_free(void *ctx, void *ptr);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
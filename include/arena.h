@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stddef.h>
+#include "allocator.h"
+
+/**
+ * The default size of the chunks an arena allocates, in bytes.
+ */
+#define BSTD_ARENA_DEFAULT_CHUNK_SIZE 4096
+
+#ifdef __cplusplus
+#define BSTD_ARENA_ALIGNED alignas(16)
+#else
+#define BSTD_ARENA_ALIGNED _Alignas(16)
+#endif // __cplusplus
+
+/**
+ * A chunk of memory owned by a bstd_arena.
+ */
+typedef struct bstd_arena_chunk_t {
+    struct bstd_arena_chunk_t *next;
+    size_t size;
+    size_t used;
+    BSTD_ARENA_ALIGNED unsigned char data[];
+} bstd_arena_chunk;
+
+/**
+ * A bump allocator: allocations are carved from large chunks and are only released all at once.
+ * Use an arena for memory that shares a lifetime, such as the temporaries of a single record or a program's WORKING-STORAGE.
+ * Initialize instances with bstd_arena_init or bstd_arena_init_with_allocator.
+ */
+typedef struct bstd_arena_t {
+    bstd_arena_chunk *head;
+    bstd_arena_chunk *current;
+    size_t chunk_size;
+    bstd_allocator allocator;
+} bstd_arena;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Initializes the specified arena, which allocates its chunks with the current allocator.
+ * No memory is allocated until the first allocation.
+ * @param arena The arena to initialize.
+ * @param chunk_size The size of the chunks the arena allocates; zero selects BSTD_ARENA_DEFAULT_CHUNK_SIZE.
+ */
+void bstd_arena_init(bstd_arena *arena, size_t chunk_size);
+
+/**
+ * Initializes the specified arena, which allocates its chunks with the specified allocator instead of the current one.
+ * @param arena The arena to initialize.
+ * @param chunk_size The size of the chunks the arena allocates; zero selects BSTD_ARENA_DEFAULT_CHUNK_SIZE.
+ * @param allocator The allocator for the arena's chunks; it is copied.
+ */
+void bstd_arena_init_with_allocator(bstd_arena *arena, size_t chunk_size, const bstd_allocator *allocator);
+
+/**
+ * Allocates the specified number of bytes from the specified arena. The memory is aligned to 16 bytes.
+ * Requests larger than the arena's chunk size get a chunk of their own.
+ * @param arena The arena to allocate from.
+ * @param size The number of bytes to allocate.
+ * @return Returns the allocated memory, or NULL if a new chunk could not be allocated.
+ */
+void* bstd_arena_alloc(bstd_arena *arena, size_t size);
+
+/**
+ * Releases every allocation made from the specified arena at once. The arena keeps its chunks for reuse.
+ * @param arena The arena to reset.
+ */
+void bstd_arena_reset(bstd_arena *arena);
+
+/**
+ * Releases every allocation and every chunk of the specified arena. The arena may be reused afterwards.
+ * @param arena The arena to destroy.
+ */
+void bstd_arena_destroy(bstd_arena *arena);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
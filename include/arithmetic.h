@@ -1,6 +1,8 @@
 #pragma once
 
+#include <stddef.h>
 #include "number.h"
+#include "arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -10,6 +12,31 @@ uint64_t max(uint64_t a, uint64_t b);
 
 int64_t ipow(int64_t base, uint64_t exp);
 
+/**
+ * A loop-invariant divisor together with its precomputed reciprocal multiplier.
+ * Dividing by a prepared divisor replaces the hardware division by a multiplication and a shift.
+ * Initialize instances with bstd_divisor_init.
+ */
+typedef struct bstd_divisor_t {
+    uint64_t value;
+    uint64_t scale;
+    bool negative;
+    uint64_t magic;
+    uint8_t shift;
+    bool add;
+} bstd_divisor;
+
+/**
+ * A running sum for repeated ADD or SUBTRACT into the same target, held as an unnormalized 128-bit integer at a fixed scale.
+ * The sum of an unsigned target drops its sign after every step, as the target itself would.
+ * Initialize instances with bstd_accumulator_init and write the sum back with bstd_accumulator_store.
+ */
+typedef struct bstd_accumulator_t {
+    __int128 sum;
+    uint64_t scale;
+    bool isSigned;
+} bstd_accumulator;
+
 /**
  * Sums the specified left- and right-hand sides, and assigns the result to the specified left-hand side.
  * This function does not modify the right-hand side.
@@ -26,6 +53,24 @@ void bstd_add(bstd_number *lhs, const bstd_number *rhs);
  */
 bstd_number* bstd_sum(const bstd_number *lhs, const bstd_number *rhs);
 
+/**
+ * Sums the specified left- and right-hand sides in the specified arena, as bstd_sum does.
+ * @param arena The arena to allocate the result from; NULL allocates it with the current allocator.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ * @return Returns the sum, released with its arena.
+ */
+bstd_number* bstd_sum_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Sums the specified left- and right-hand sides, and stores the result in the specified output number.
+ * This function does not allocate and does not modify either of its operands. The output may alias either operand.
+ * @param out The number to store the sum in. Its previous constraints are overwritten.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ */
+void bstd_sum_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs);
+
 /**
  * Subtracts the specified right-hand side from the specified left-hand side, and assigns the result to the left-hand side.
  * This function does not modify the right-hand side.
@@ -42,6 +87,197 @@ void bstd_subtract(bstd_number *lhs, const bstd_number *rhs);
  */
 bstd_number* bstd_difference(const bstd_number *lhs, const bstd_number *rhs);
 
+/**
+ * Subtracts the specified right-hand side from the specified left-hand side in the specified arena, as bstd_difference does.
+ * @param arena The arena to allocate the result from; NULL allocates it with the current allocator.
+ * @param lhs The left-hand side of the subtraction.
+ * @param rhs The right-hand side of the subtraction.
+ * @return Returns the difference, released with its arena.
+ */
+bstd_number* bstd_difference_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Subtracts the specified right-hand side from the specified left-hand side, and stores the result in the specified output number.
+ * This function does not allocate and does not modify either of its operands. The output may alias either operand.
+ * @param out The number to store the difference in. Its previous constraints are overwritten.
+ * @param lhs The left-hand side of the subtraction.
+ * @param rhs The right-hand side of the subtraction.
+ */
+void bstd_difference_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Sums the specified left- and right-hand sides and assigns the result to the left-hand side, unless a size error occurs:
+ * a size error occurs when the integer digits of the sum do not fit the left-hand side's length, as for ADD ... ON SIZE ERROR.
+ * Without a size error, the result is identical to that of bstd_add for results of up to 18 digits.
+ * @param lhs The left-hand side of the addition. Left unchanged on a size error.
+ * @param rhs The right-hand side of the addition.
+ * @return Returns false iff a size error occurred.
+ */
+bool bstd_add_checked(bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Subtracts the specified right-hand side from the left-hand side and assigns the result to the left-hand side, unless a size error occurs.
+ * Without a size error, the result is identical to that of bstd_subtract for results of up to 18 digits.
+ * @param lhs The left-hand side of the subtraction. Left unchanged on a size error.
+ * @param rhs The right-hand side of the subtraction.
+ * @return Returns false iff a size error occurred.
+ */
+bool bstd_subtract_checked(bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Multiplies the left-hand side by the specified right-hand side and assigns the result to the left-hand side, unless a size error occurs.
+ * Without a size error, the result is identical to that of bstd_multiply.
+ * @param lhs The left-hand side of the multiplication. Left unchanged on a size error.
+ * @param rhs The right-hand side of the multiplication.
+ * @return Returns false iff a size error occurred.
+ */
+bool bstd_multiply_checked(bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Multiplies the specified left-hand side by the specified right-hand side, and assigns the result to the left-hand side.
+ * The exact product is truncated to the left-hand side's scale and length, following the BabyCobol assignment specifications.
+ * This function does not modify the right-hand side.
+ * @param lhs The left-hand side of the multiplication.
+ * @param rhs The right-hand side of the multiplication.
+ */
+void bstd_multiply(bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Multiplies the specified left- and right-hand sides, and returns the result.
+ * The scale of the result is the sum of the scales of both sides.
+ * This function does not modify either of its parameters.
+ * @param lhs The left-hand side of the multiplication.
+ * @param rhs The right-hand side of the multiplication.
+ */
+bstd_number* bstd_product(const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Multiplies the specified left- and right-hand sides in the specified arena, as bstd_product does.
+ * @param arena The arena to allocate the result from; NULL allocates it with the current allocator.
+ * @param lhs The left-hand side of the multiplication.
+ * @param rhs The right-hand side of the multiplication.
+ * @return Returns the product, released with its arena.
+ */
+bstd_number* bstd_product_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Multiplies the specified left- and right-hand sides, and stores the result in the specified output number.
+ * The scale of the result is the sum of the scales of both sides, limited to 18 fractional digits.
+ * This function does not allocate and does not modify either of its operands. The output may alias either operand.
+ * @param out The number to store the product in. Its previous constraints are overwritten.
+ * @param lhs The left-hand side of the multiplication.
+ * @param rhs The right-hand side of the multiplication.
+ */
+void bstd_product_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Divides the specified left-hand side by the specified right-hand side, and assigns the result to the left-hand side.
+ * The exact quotient is truncated to the left-hand side's scale and length, following the BabyCobol assignment specifications.
+ * If the right-hand side is zero, the left-hand side is left unchanged.
+ * This function does not modify the right-hand side.
+ * @param lhs The dividend, which receives the quotient.
+ * @param rhs The divisor.
+ */
+void bstd_divide(bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Divides the specified left-hand side by the specified right-hand side, and returns the result.
+ * The scale of the result is the larger of the scales of both sides.
+ * This function does not modify either of its parameters.
+ * @param lhs The dividend.
+ * @param rhs The divisor.
+ * @return Returns the quotient, or NULL if the divisor is zero.
+ */
+bstd_number* bstd_quotient(const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Divides the specified left-hand side by the specified right-hand side in the specified arena, as bstd_quotient does.
+ * @param arena The arena to allocate the result from; NULL allocates it with the current allocator.
+ * @param lhs The dividend.
+ * @param rhs The divisor.
+ * @return Returns the quotient, released with its arena, or NULL if the divisor is zero.
+ */
+bstd_number* bstd_quotient_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Divides the specified left-hand side by the specified right-hand side, and stores the result in the specified output number.
+ * The scale of the result is the larger of the scales of both sides. If the divisor is zero, the output is left unchanged.
+ * This function does not allocate and does not modify either of its operands. The output may alias either operand.
+ * @param out The number to store the quotient in. Its previous constraints are overwritten.
+ * @param lhs The dividend.
+ * @param rhs The divisor.
+ */
+void bstd_quotient_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs);
+
+/**
+ * Divides the specified dividend by the specified divisor, storing both the quotient and the remainder.
+ * The quotient is truncated to the scale and length of the quotient number. The remainder is defined as
+ * dividend - (quotient * divisor), computed exactly using the quotient truncated to its scale, and then assigned to the
+ * remainder number following the BabyCobol assignment specifications.
+ * If the divisor is zero, neither the quotient nor the remainder is modified. If the quotient does not fit the length of
+ * the quotient number, the quotient is cropped as bstd_divide crops it, and the remainder is not modified.
+ * @param quotient The number to store the quotient in.
+ * @param remainder The number to store the remainder in.
+ * @param dividend The dividend.
+ * @param divisor The divisor.
+ */
+void bstd_divide_remainder(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_number *divisor);
+
+/**
+ * Prepares the specified divisor for repeated division by precomputing its reciprocal multiplier.
+ * The prepared divisor is an independent copy; later changes to the number do not affect it.
+ * @param divisor The divisor to initialize.
+ * @param number The number to divide by.
+ */
+void bstd_divisor_init(bstd_divisor *divisor, const bstd_number *number);
+
+/**
+ * Divides the specified left-hand side by the specified prepared divisor, and assigns the result to the left-hand side.
+ * The result is identical to that of bstd_divide.
+ * @param lhs The dividend, which receives the quotient.
+ * @param rhs The prepared divisor.
+ */
+void bstd_divide_by(bstd_number *lhs, const bstd_divisor *rhs);
+
+/**
+ * Divides the specified dividend by the specified prepared divisor, storing both the quotient and the remainder.
+ * The results are identical to those of bstd_divide_remainder.
+ * @param quotient The number to store the quotient in.
+ * @param remainder The number to store the remainder in.
+ * @param dividend The dividend.
+ * @param divisor The prepared divisor.
+ */
+void bstd_divide_remainder_by(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_divisor *divisor);
+
+/**
+ * Adds rhs[i] to lhs[i] for every i < n, with the same result as calling bstd_add for every element.
+ * The batch is processed by vectorized kernels if all elements of lhs share the constraints of lhs[0], which is at most
+ * 18 digits long, and all elements of rhs share its scale and are no longer. Other batches are processed element by element.
+ * @param lhs The left-hand sides of the additions.
+ * @param rhs The right-hand sides of the additions.
+ * @param n The number of elements in both arrays.
+ */
+void bstd_add_n(bstd_number *lhs, const bstd_number *rhs, size_t n);
+
+/**
+ * Subtracts rhs[i] from lhs[i] for every i < n, with the same result as calling bstd_subtract for every element.
+ * The batch is processed by vectorized kernels under the same conditions as bstd_add_n.
+ * @param lhs The left-hand sides of the subtractions.
+ * @param rhs The right-hand sides of the subtractions.
+ * @param n The number of elements in both arrays.
+ */
+void bstd_subtract_n(bstd_number *lhs, const bstd_number *rhs, size_t n);
+
+/**
+ * Adds the specified right-hand side to lhs[i] for every i < n, with the same result as calling bstd_add for every element.
+ * The batch is processed by vectorized kernels if all elements of lhs share the constraints of lhs[0], the right-hand
+ * side shares their scale and is no longer than lhs[0], which is at most 18 digits long.
+ * @param lhs The left-hand sides of the additions.
+ * @param rhs The right-hand side added to every element.
+ * @param n The number of elements in lhs.
+ */
+void bstd_add_scalar_n(bstd_number *lhs, const bstd_number *rhs, size_t n);
+
 /**
  * Addition between an Number (lhs) and an int (rhs)
  * @param lhs The left-hand side of the addition.
@@ -70,6 +306,51 @@ void bstd_add_double(bstd_number *lhs, double rhs);
  */
 void bstd_subtract_double(bstd_number *lhs, double rhs);
 
+/**
+ * Initializes the specified accumulator with the value, scale and signedness of the specified target.
+ * @param accumulator The accumulator to initialize.
+ * @param target The number the accumulated sum will be stored into.
+ */
+void bstd_accumulator_init(bstd_accumulator *accumulator, const bstd_number *target);
+
+/**
+ * Adds the specified number to the specified accumulator.
+ * Digits beyond the accumulator's scale are truncated towards zero, exactly as bstd_add truncates them on every addition.
+ * @param accumulator The accumulator to add to.
+ * @param rhs The number to add.
+ */
+void bstd_accumulator_add(bstd_accumulator *accumulator, const bstd_number *rhs);
+
+/**
+ * Subtracts the specified number from the specified accumulator, truncating as bstd_subtract does.
+ * @param accumulator The accumulator to subtract from.
+ * @param rhs The number to subtract.
+ */
+void bstd_accumulator_subtract(bstd_accumulator *accumulator, const bstd_number *rhs);
+
+/**
+ * Adds the specified integer to the specified accumulator.
+ * @param accumulator The accumulator to add to.
+ * @param rhs The integer to add.
+ */
+void bstd_accumulator_add_int64(bstd_accumulator *accumulator, int64_t rhs);
+
+/**
+ * Subtracts the specified integer from the specified accumulator.
+ * @param accumulator The accumulator to subtract from.
+ * @param rhs The integer to subtract.
+ */
+void bstd_accumulator_subtract_int64(bstd_accumulator *accumulator, int64_t rhs);
+
+/**
+ * Stores the accumulated sum into the specified target, following the BabyCobol assignment specifications.
+ * The target holds the same value as after the equivalent sequence of bstd_add and bstd_subtract calls, unless
+ * the sum (or a partial sum) does not fit the target's length, in which case only the final sum is cropped.
+ * @param accumulator The accumulator holding the sum.
+ * @param target The number to store the sum into. This is normally the number the accumulator was initialized with.
+ */
+void bstd_accumulator_store(const bstd_accumulator *accumulator, bstd_number *target);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
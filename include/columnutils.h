@@ -0,0 +1,81 @@
+#pragma once
+
+#include "number.h"
+#include "number_column.h"
+#include "arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Creates a new column of the specified size, whose elements all hold zero under the specified constraints.
+ * The column is a single allocation; release it with bstd_free.
+ * @param size The number of elements in the column.
+ * @param length The length of every element. At most 18.
+ * @param scale The scale of every element.
+ * @param isSigned If true, the elements are signed.
+ * @return Returns a new bstd_number_column, or NULL if the length exceeds 18 or the column cannot be allocated.
+ */
+bstd_number_column* bstd_create_number_column(size_t size, uint8_t length, uint64_t scale, bool isSigned);
+
+/**
+ * Creates a new column in the specified arena, as bstd_create_number_column does.
+ * @param arena The arena to allocate the column from; NULL allocates it with the current allocator.
+ * @param size The number of elements in the column.
+ * @param length The length of every element. At most 18.
+ * @param scale The scale of every element.
+ * @param isSigned If true, the elements are signed.
+ * @return Returns a new bstd_number_column, released with its arena, or NULL if the length exceeds 18 or the column cannot be allocated.
+ */
+bstd_number_column* bstd_create_number_column_arena(bstd_arena* arena, size_t size, uint8_t length, uint64_t scale, bool isSigned);
+
+/**
+ * Gets the element at the specified index of the specified column as a bstd_number.
+ * @param column The column to get the element from.
+ * @param index The index of the element. Must be less than the column's size.
+ * @param out The number to store the element in. Its constraints are overwritten with those of the column.
+ */
+void bstd_number_column_get(const bstd_number_column* column, size_t index, bstd_number* out);
+
+/**
+ * Assigns the specified number to the element at the specified index of the specified column.
+ * The column's constraints are leading, following the BabyCobol assignment specifications.
+ * @param column The column to assign the element in.
+ * @param index The index of the element. Must be less than the column's size.
+ * @param value The number to assign.
+ */
+void bstd_number_column_set(bstd_number_column* column, size_t index, const bstd_number* value);
+
+/**
+ * Calls the specified function for every element of the specified column, in order.
+ * @param column The column to iterate.
+ * @param fn The function to call. It receives the element as a bstd_number, its index and the specified context.
+ * @param context An arbitrary pointer passed to every call of fn.
+ */
+void bstd_number_column_for_each(const bstd_number_column* column, void (*fn)(const bstd_number* element, size_t index, void* context), void* context);
+
+/**
+ * Adds rhs[i] to lhs[i] for every element, with the same result as calling bstd_add for every element.
+ * @param lhs The column to add to. Must be of the same size as rhs.
+ * @param rhs The column to add.
+ */
+void bstd_number_column_add(bstd_number_column* lhs, const bstd_number_column* rhs);
+
+/**
+ * Subtracts rhs[i] from lhs[i] for every element, with the same result as calling bstd_subtract for every element.
+ * @param lhs The column to subtract from. Must be of the same size as rhs.
+ * @param rhs The column to subtract.
+ */
+void bstd_number_column_subtract(bstd_number_column* lhs, const bstd_number_column* rhs);
+
+/**
+ * Adds the specified number to every element of the specified column, with the same result as calling bstd_add for every element.
+ * @param lhs The column to add to.
+ * @param rhs The number to add to every element.
+ */
+void bstd_number_column_add_number(bstd_number_column* lhs, const bstd_number* rhs);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+#define BSTD_COMPACT_NUMBER_MAX_LENGTH 18
+
+/**
+ * Flag marking a signed bstd_compact_number.
+ */
+#define BSTD_COMPACT_SIGNED 0x01
+
+/**
+ * A compact, 16-byte representation of a BabyCobol numeric value of up to 18 digits.
+ * Unlike bstd_number, the value is held in two's complement, so no separate sign has to be consulted.
+ * The values of unsigned compact numbers are never negative.
+ */
+typedef struct bstd_compact_number_t {
+    int64_t value;
+    uint8_t scale;
+    uint8_t length;
+    uint8_t flags;
+} bstd_compact_number;
+
+#ifdef __cplusplus
+static_assert(sizeof(bstd_compact_number) == 16, "bstd_compact_number must be 16 bytes");
+#else
+_Static_assert(sizeof(bstd_compact_number) == 16, "bstd_compact_number must be 16 bytes");
+#endif // __cplusplus
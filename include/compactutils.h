@@ -0,0 +1,58 @@
+#pragma once
+
+#include "number.h"
+#include "compact_number.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Converts the specified number to its compact representation.
+ * Numbers longer than 18 digits keep only their 18 least-significant digits.
+ * @param out The compact number to store the conversion in. Its constraints are overwritten.
+ * @param number The number to convert.
+ */
+void bstd_compact_from_number(bstd_compact_number* out, const bstd_number* number);
+
+/**
+ * Converts the specified compact number to a bstd_number.
+ * @param out The number to store the conversion in. Its constraints are overwritten.
+ * @param compact The compact number to convert.
+ */
+void bstd_compact_to_number(bstd_number* out, const bstd_compact_number* compact);
+
+/**
+ * Assigns the specified compact value to the specified compact assignee. If the numbers' constraints do not match, the assignee's constraints are leading.
+ * @param assignee The compact number to assign the specified value to.
+ * @param value The compact number to assign.
+ */
+void bstd_compact_assign(bstd_compact_number* assignee, const bstd_compact_number* value);
+
+/**
+ * Sums the specified left- and right-hand sides, and assigns the result to the specified left-hand side.
+ * The result is identical to that of bstd_add on the equivalent bstd_number values.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ */
+void bstd_compact_add(bstd_compact_number* lhs, const bstd_compact_number* rhs);
+
+/**
+ * Subtracts the specified right-hand side from the specified left-hand side, and assigns the result to the left-hand side.
+ * The result is identical to that of bstd_subtract on the equivalent bstd_number values.
+ * @param lhs The left-hand side of the subtraction.
+ * @param rhs The right-hand side of the subtraction.
+ */
+void bstd_compact_subtract(bstd_compact_number* lhs, const bstd_compact_number* rhs);
+
+/**
+ * Compares the specified compact numbers exactly, regardless of their scales.
+ * @param lhs The left-hand side of the comparison.
+ * @param rhs The right-hand side of the comparison.
+ * @return Returns -1 if lhs < rhs, 0 if lhs == rhs and 1 if lhs > rhs.
+ */
+int bstd_compact_compare(const bstd_compact_number* lhs, const bstd_compact_number* rhs);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include "number.h"
+#include "expression.h"
+#include "arena.h"
+
+/**
+ * The maximum depth of the evaluation stack of a compiled COMPUTE expression.
+ */
+#define BSTD_COMPUTE_MAX_DEPTH 32
+
+/**
+ * The maximum scale of an intermediate result. Digits of products and quotients beyond this scale are truncated.
+ */
+#define BSTD_COMPUTE_MAX_SCALE 18
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Compiles the specified expression tree into bytecode. The tree is not needed after compilation.
+ * @param expression The root of the expression tree.
+ * @return Returns the compiled program, or NULL if the tree is malformed or needs more than BSTD_COMPUTE_MAX_DEPTH stack slots.
+ */
+bstd_program* bstd_compute_compile(const bstd_expression *expression);
+
+/**
+ * Compiles the specified expression tree into bytecode allocated in the specified arena, as bstd_compute_compile does.
+ * @param arena The arena to allocate the program from; NULL allocates it with the current allocator.
+ * @param expression The root of the expression tree.
+ * @return Returns the compiled program, released with its arena, or NULL if the tree is malformed or too deep.
+ */
+bstd_program* bstd_compute_compile_arena(bstd_arena *arena, const bstd_expression *expression);
+
+/**
+ * Evaluates the specified program against the specified operands, and assigns the result to the specified target
+ * following the BabyCobol assignment specifications.
+ * Intermediate results are exact 128-bit values at their natural scale: sums align scales, products add them and
+ * quotients are computed at the largest scale of the dividend, the divisor and the target. Only digits beyond
+ * BSTD_COMPUTE_MAX_SCALE are dropped along the way; the result is truncated once, when it is stored in the target.
+ * @param program The compiled expression.
+ * @param operands The numbers referred to by the expression's operand nodes, by index.
+ * @param target The number to store the result in.
+ * @return Returns false, leaving the target unchanged, if a division by zero occurs or an intermediate result does not fit 128 bits.
+ * Otherwise, returns true.
+ */
+bool bstd_compute(const bstd_program *program, const bstd_number *const *operands, bstd_number *target);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <stddef.h>
+#include "number.h"
+
+/**
+ * The number of bytes of a packed-decimal (COMP-3) field holding the specified number of digits.
+ */
+#define BSTD_PACKED_SIZE(digits) ((size_t) (digits) / 2 + 1)
+
+/**
+ * The largest packed-decimal field, in bytes, that converts to and from bstd_number: 19 digits and a sign.
+ */
+#define BSTD_PACKED_MAX_SIZE 10
+
+/**
+ * Sign nibbles written to packed-decimal fields.
+ */
+#define BSTD_PACKED_SIGN_POSITIVE 0x0C
+#define BSTD_PACKED_SIGN_NEGATIVE 0x0D
+#define BSTD_PACKED_SIGN_UNSIGNED 0x0F
+
+/**
+ * The largest zoned-decimal field, in digits, that converts to and from bstd_number.
+ */
+#define BSTD_ZONED_MAX_DIGITS 19
+
+/**
+ * The position of the sign in a zoned-decimal (DISPLAY numeric) field, as set by the SIGN clause.
+ * Embedded signs are overpunched on a digit: '{' and 'A' to 'I' are +0 to +9, '}' and 'J' to 'R' are -0 to -9.
+ * Separate signs take a character of their own, '+' or '-'.
+ */
+typedef enum bstd_zoned_sign_t {
+    BSTD_ZONED_UNSIGNED,
+    BSTD_ZONED_TRAILING,
+    BSTD_ZONED_LEADING,
+    BSTD_ZONED_TRAILING_SEPARATE,
+    BSTD_ZONED_LEADING_SEPARATE
+} bstd_zoned_sign;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Decodes the specified packed-decimal (COMP-3) field and assigns its value to the specified number, following the BabyCobol assignment specifications.
+ * The field holds two digits per byte, most significant first, and ends with a sign nibble: 0xB and 0xD are negative, 0xA, 0xC, 0xE and 0xF are positive.
+ * The scale of the field is implied by the number's scale, as the picture of a COMP-3 field implies its decimal point.
+ * @param number The number to assign the decoded value to. Left unchanged if the field is invalid.
+ * @param bytes The packed-decimal field.
+ * @param size The size of the field in bytes. At most BSTD_PACKED_MAX_SIZE.
+ * @return Returns true iff the field holds valid digits and a valid sign.
+ */
+bool bstd_number_from_packed(bstd_number* number, const unsigned char* bytes, size_t size);
+
+/**
+ * Encodes the specified number as a packed-decimal (COMP-3) field of the specified size.
+ * The field holds the number's 2 * size - 1 least-significant digits at the number's own scale, followed by the sign nibble:
+ * 0xC or 0xD for signed numbers and 0xF for unsigned numbers.
+ * @param number The number to encode.
+ * @param bytes The buffer to write the field to. Must hold at least size bytes.
+ * @param size The size of the field in bytes. At most BSTD_PACKED_MAX_SIZE.
+ */
+void bstd_number_to_packed(const bstd_number* number, unsigned char* bytes, size_t size);
+
+/**
+ * Decodes the packed-decimal field at the specified offset of each of the specified records, as bstd_number_from_packed does.
+ * @param numbers The numbers to assign the decoded values to, one per record. Numbers of invalid fields are left unchanged.
+ * @param records The records, stored back to back.
+ * @param record_size The size of every record in bytes.
+ * @param offset The offset of the field within every record.
+ * @param size The size of the field in bytes.
+ * @param n The number of records.
+ * @return Returns the number of fields that were decoded successfully.
+ */
+size_t bstd_number_from_packed_n(bstd_number* numbers, const unsigned char* records, size_t record_size, size_t offset, size_t size, size_t n);
+
+/**
+ * Encodes the specified numbers into the packed-decimal field at the specified offset of each of the specified records, as bstd_number_to_packed does.
+ * The remaining bytes of the records are left untouched.
+ * @param numbers The numbers to encode, one per record.
+ * @param records The records, stored back to back.
+ * @param record_size The size of every record in bytes.
+ * @param offset The offset of the field within every record.
+ * @param size The size of the field in bytes.
+ * @param n The number of records.
+ */
+void bstd_number_to_packed_n(const bstd_number* numbers, unsigned char* records, size_t record_size, size_t offset, size_t size, size_t n);
+
+/**
+ * Decodes the specified zoned-decimal field and assigns its value to the specified number, following the BabyCobol assignment specifications.
+ * The scale of the field is implied by the number's scale. An embedded sign also accepts a plain digit, which is positive.
+ * @param number The number to assign the decoded value to. Left unchanged if the field is invalid.
+ * @param str The zoned-decimal field.
+ * @param size The size of the field in characters, including a separate sign. At most BSTD_ZONED_MAX_DIGITS digits.
+ * @param sign The position of the field's sign.
+ * @return Returns true iff the field holds valid digits and a valid sign.
+ */
+bool bstd_number_from_zoned(bstd_number* number, const char* str, size_t size, bstd_zoned_sign sign);
+
+/**
+ * Encodes the specified number as a zoned-decimal field of the specified size.
+ * The field holds the number's least-significant digits at the number's own scale; zero is written as positive.
+ * @param number The number to encode.
+ * @param str The buffer to write the field to. Must hold at least size characters; no terminator is written.
+ * @param size The size of the field in characters, including a separate sign. At most BSTD_ZONED_MAX_DIGITS digits.
+ * @param sign The position of the field's sign.
+ */
+void bstd_number_to_zoned(const bstd_number* number, char* str, size_t size, bstd_zoned_sign sign);
+
+/**
+ * Decodes the zoned-decimal field at the specified offset of each of the specified records, as bstd_number_from_zoned does.
+ * @param numbers The numbers to assign the decoded values to, one per record. Numbers of invalid fields are left unchanged.
+ * @param records The records, stored back to back.
+ * @param record_size The size of every record in bytes.
+ * @param offset The offset of the field within every record.
+ * @param size The size of the field in characters.
+ * @param sign The position of the field's sign.
+ * @param n The number of records.
+ * @return Returns the number of fields that were decoded successfully.
+ */
+size_t bstd_number_from_zoned_n(bstd_number* numbers, const char* records, size_t record_size, size_t offset, size_t size, bstd_zoned_sign sign, size_t n);
+
+/**
+ * Encodes the specified numbers into the zoned-decimal field at the specified offset of each of the specified records, as bstd_number_to_zoned does.
+ * The remaining bytes of the records are left untouched.
+ * @param numbers The numbers to encode, one per record.
+ * @param records The records, stored back to back.
+ * @param record_size The size of every record in bytes.
+ * @param offset The offset of the field within every record.
+ * @param size The size of the field in characters.
+ * @param sign The position of the field's sign.
+ * @param n The number of records.
+ */
+void bstd_number_to_zoned_n(const bstd_number* numbers, char* records, size_t record_size, size_t offset, size_t size, bstd_zoned_sign sign, size_t n);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * The kinds of nodes of a COMPUTE expression tree.
+ */
+typedef enum bstd_expression_kind_t {
+    BSTD_EXPRESSION_OPERAND,
+    BSTD_EXPRESSION_ADD,
+    BSTD_EXPRESSION_SUBTRACT,
+    BSTD_EXPRESSION_MULTIPLY,
+    BSTD_EXPRESSION_DIVIDE,
+    BSTD_EXPRESSION_NEGATE
+} bstd_expression_kind;
+
+/**
+ * A node of a COMPUTE expression tree, such as (A + B) * C - D / E.
+ * Operand nodes refer to a number by its index in the operand array passed to bstd_compute; they have no children.
+ * Negation nodes only have a left-hand child; all other nodes have both children.
+ */
+typedef struct bstd_expression_t {
+    bstd_expression_kind kind;
+    size_t operand;
+    const struct bstd_expression_t *lhs;
+    const struct bstd_expression_t *rhs;
+} bstd_expression;
+
+/**
+ * A single instruction of a compiled COMPUTE expression.
+ * Push instructions carry the index of the operand they push; arithmetic instructions pop their operands and push the result.
+ */
+typedef struct bstd_instruction_t {
+    uint8_t opcode;
+    uint32_t operand;
+} bstd_instruction;
+
+/**
+ * A COMPUTE expression compiled into postfix bytecode, ready to be evaluated repeatedly.
+ * The program is a single allocation; release it with bstd_free.
+ */
+typedef struct bstd_program_t {
+    size_t size;
+    size_t operands;
+    bstd_instruction code[];
+} bstd_program;
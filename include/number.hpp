@@ -0,0 +1,283 @@
+#pragma once
+
+#include <cstdint>
+#include "number.h"
+
+/*
+ * Compile-time counterpart of bstd_number for generated C++ code.
+ * Constraints are template parameters, so every power of ten and every cropping limit is a constant expression;
+ * results are identical to those of the corresponding C functions.
+ * Requires C++14 and a compiler that supports __int128.
+ */
+
+namespace bstd {
+
+namespace detail {
+
+/**
+ * The number of digits a computed (giving) result may hold before it is truncated.
+ */
+constexpr unsigned result_max_digits = 18;
+
+/**
+ * Gets ten to the power of the specified exponent.
+ * @param exp The exponent. Exponents larger than 19 overflow.
+ * @return Returns 10^exp.
+ */
+constexpr uint64_t pow10(unsigned exp) {
+    uint64_t result = 1;
+    while (exp-- > 0) {
+        result *= 10;
+    }
+    return result;
+}
+
+/**
+ * Converts the specified scaled integer from one scale to another, truncating towards zero.
+ * @param value The scaled integer to convert.
+ * @param from The scale of the specified value.
+ * @param to The scale to convert the value to.
+ * @return Returns the value at the target scale.
+ */
+constexpr __int128 rescale(__int128 value, uint64_t from, uint64_t to) {
+    if (to >= from) {
+        return value * (__int128) pow10((unsigned) (to - from));
+    }
+    if (from - to > 19) {
+        return 0;
+    }
+    // integer division truncates towards zero, as BabyCobol assignment requires
+    return value / (__int128) pow10((unsigned) (from - to));
+}
+
+/**
+ * Keeps the specified number of least-significant digits of the specified value, retaining its sign.
+ */
+constexpr __int128 crop(__int128 value, unsigned digits) {
+    return value % (__int128) pow10(digits);
+}
+
+constexpr unsigned max(unsigned a, unsigned b) {
+    return a > b ? a : b;
+}
+
+constexpr unsigned min(unsigned a, unsigned b) {
+    return a < b ? a : b;
+}
+
+} // namespace detail
+
+/**
+ * A BabyCobol numeric value whose constraints are known at compile time.
+ * The value is held as a scaled integer in two's complement; unsigned numbers never hold negative values.
+ * @tparam Length The total number of digits, including the fractional digits. At most 18.
+ * @tparam Scale The number of fractional digits.
+ * @tparam Signed If true, the number may hold negative values.
+ */
+template <unsigned Length, unsigned Scale, bool Signed>
+class number {
+
+    static_assert(Length >= 1 && Length <= detail::result_max_digits, "Length must lie within [1, 18]");
+    static_assert(Scale <= Length, "Scale must not exceed Length");
+
+public:
+
+    static constexpr unsigned length = Length;
+    static constexpr unsigned scale = Scale;
+    static constexpr bool is_signed = Signed;
+
+    constexpr number() : value_(0) {}
+
+    /**
+     * Creates a number for the specified bstd_number, following the BabyCobol assignment specifications.
+     */
+    constexpr explicit number(const bstd_number& other) : value_(store(detail::rescale(signed_value(other), other.scale, Scale))) {}
+
+    /**
+     * Creates a number for a number of other constraints, following the BabyCobol assignment specifications.
+     */
+    template <unsigned L, unsigned S, bool G>
+    constexpr number(const number<L, S, G>& other) : value_(store(detail::rescale(other.scaled(), S, Scale))) {}
+
+    /**
+     * Creates a number holding the specified scaled integer; 1234 creates 12.34 for a scale of two.
+     */
+    static constexpr number from_scaled(int64_t value) {
+        number result;
+        result.value_ = store(value);
+        return result;
+    }
+
+    /**
+     * Creates a number holding the specified integer.
+     */
+    static constexpr number from_integer(int64_t value) {
+        number result;
+        result.value_ = store(detail::rescale(value, 0, Scale));
+        return result;
+    }
+
+    /**
+     * Gets the value of this number as a scaled integer.
+     */
+    constexpr int64_t scaled() const {
+        return value_;
+    }
+
+    /**
+     * Converts this number to a bstd_number of the same constraints.
+     */
+    constexpr bstd_number to_number() const {
+        return bstd_number{
+                (uint64_t) (value_ < 0 ? -value_ : value_),
+                Scale,
+                (uint8_t) Length,
+                Signed,
+                value_ >= 0
+        };
+    }
+
+    /**
+     * Assigns the specified number, following the BabyCobol assignment specifications.
+     */
+    template <unsigned L, unsigned S, bool G>
+    constexpr number& operator=(const number<L, S, G>& other) {
+        value_ = store(detail::rescale(other.scaled(), S, Scale));
+        return *this;
+    }
+
+    /**
+     * Adds the specified number to this number, as bstd_add does.
+     */
+    template <unsigned L, unsigned S, bool G>
+    constexpr number& operator+=(const number<L, S, G>& rhs) {
+        constexpr unsigned s = detail::max(Scale, S);
+        const __int128 sum = detail::rescale(value_, Scale, s) + detail::rescale(rhs.scaled(), S, s);
+        value_ = store(detail::rescale(detail::crop(sum, detail::result_max_digits), s, Scale));
+        return *this;
+    }
+
+    /**
+     * Subtracts the specified number from this number, as bstd_subtract does.
+     */
+    template <unsigned L, unsigned S, bool G>
+    constexpr number& operator-=(const number<L, S, G>& rhs) {
+        constexpr unsigned s = detail::max(Scale, S);
+        const __int128 difference = detail::rescale(value_, Scale, s) - detail::rescale(rhs.scaled(), S, s);
+        value_ = store(detail::rescale(detail::crop(difference, detail::result_max_digits), s, Scale));
+        return *this;
+    }
+
+    /**
+     * Multiplies this number by the specified number, as bstd_multiply does.
+     */
+    template <unsigned L, unsigned S, bool G>
+    constexpr number& operator*=(const number<L, S, G>& rhs) {
+        value_ = store((__int128) value_ * rhs.scaled() / (__int128) detail::pow10(S));
+        return *this;
+    }
+
+private:
+
+    template <unsigned L, unsigned S, bool G>
+    friend class number;
+
+    int64_t value_;
+
+    /**
+     * Crops the specified value to this number's constraints; unsigned numbers drop the sign.
+     */
+    static constexpr int64_t store(__int128 value) {
+        const __int128 cropped = detail::crop(value, Length);
+        return (int64_t) (!Signed && cropped < 0 ? -cropped : cropped);
+    }
+
+    static constexpr __int128 signed_value(const bstd_number& other) {
+        return !other.positive && other.isSigned ? -(__int128) other.value : (__int128) other.value;
+    }
+};
+
+/**
+ * The type of the sum or difference of numbers of scales S1 and S2, which holds any such giving result.
+ */
+template <unsigned S1, unsigned S2>
+using sum_type = number<detail::result_max_digits, detail::max(S1, S2), true>;
+
+/**
+ * The type of the product of numbers of scales S1 and S2, which holds any such giving result.
+ */
+template <unsigned S1, unsigned S2>
+using product_type = number<detail::result_max_digits, detail::min(S1 + S2, detail::result_max_digits), true>;
+
+/**
+ * Sums the specified numbers, as bstd_sum does.
+ */
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr sum_type<S1, S2> operator+(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    sum_type<S1, S2> result = lhs;
+    return result += rhs;
+}
+
+/**
+ * Subtracts the specified numbers, as bstd_difference does.
+ */
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr sum_type<S1, S2> operator-(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    sum_type<S1, S2> result = lhs;
+    return result -= rhs;
+}
+
+/**
+ * Multiplies the specified numbers, as bstd_product does.
+ */
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr product_type<S1, S2> operator*(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    constexpr unsigned s = S1 + S2;
+    const __int128 product = (__int128) lhs.scaled() * rhs.scaled();
+    return product_type<S1, S2>::from_scaled(
+            (int64_t) detail::crop(detail::rescale(product, s, product_type<S1, S2>::scale), detail::result_max_digits));
+}
+
+/**
+ * Compares the specified numbers exactly, regardless of their scales.
+ * @return Returns -1 if lhs < rhs, 0 if lhs == rhs and 1 if lhs > rhs.
+ */
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr int compare(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    constexpr unsigned s = detail::max(S1, S2);
+    const __int128 a = detail::rescale(lhs.scaled(), S1, s);
+    const __int128 b = detail::rescale(rhs.scaled(), S2, s);
+    return (a > b) - (a < b);
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator==(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) == 0;
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator!=(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) != 0;
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator<(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) < 0;
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator>(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) > 0;
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator<=(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) <= 0;
+}
+
+template <unsigned L1, unsigned S1, bool G1, unsigned L2, unsigned S2, bool G2>
+constexpr bool operator>=(const number<L1, S1, G1>& lhs, const number<L2, S2, G2>& rhs) {
+    return compare(lhs, rhs) >= 0;
+}
+
+} // namespace bstd
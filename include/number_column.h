@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * A column of BabyCobol numeric values that share a single set of constraints, such as an OCCURS table of PIC S9(7)V99.
+ * Only the signed, scaled values are stored per element, contiguously; the constraints are stored once for the column.
+ * The values of unsigned columns are never negative.
+ */
+typedef struct bstd_number_column_t {
+    uint64_t scale;
+    size_t size;
+    uint8_t length;
+    bool isSigned;
+    int64_t values[];
+} bstd_number_column;
@@ -1,6 +1,23 @@
 #pragma once
 
 #include "number.h"
+#include "arena.h"
+#include <stddef.h>
+
+/**
+ * The size in bytes of the sort keys created by bstd_number_sort_key.
+ */
+#define BSTD_NUMBER_SORT_KEY_SIZE 17
+
+/**
+ * The buffer size that suffices for bstd_number_format_into to format any number: a sign, 19 digits, a decimal point and a terminator.
+ */
+#define BSTD_NUMBER_FORMAT_MAX_SIZE 22
+
+/**
+ * Returned by bstd_number_format_into for numbers that cannot be formatted, because they have more than 19 digits.
+ */
+#define BSTD_NUMBER_FORMAT_ERROR ((size_t) -1)
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +33,16 @@ extern "C" {
  */
 bstd_number* bstd_number_from_int(int value, uint64_t length, bool isSigned);
 
+/**
+ * Creates a new instance of bstd_number in the specified arena, as bstd_number_from_int does.
+ * @param arena The arena to allocate the number from; NULL allocates it with the current allocator.
+ * @param value The value the new bstd_number should hold.
+ * @param length The length of the new bstd_number.
+ * @param isSigned If true, the new bstd_number is signed.
+ * @return Returns a new instance of bstd_number, released with its arena.
+ */
+bstd_number* bstd_number_from_int_arena(bstd_arena* arena, int value, uint64_t length, bool isSigned);
+
 /**
  * Determines whether the specified number represents an integer or not.
  * (A bstd_number is an integer iff its scale is equal to zero.)
@@ -68,6 +95,24 @@ void bstd_assign_int(bstd_number* number, int value);
  */
 void bstd_assign_int64(bstd_number* number, int64_t value);
 
+/**
+ * Assigns the specified value to the specified assignee as bstd_assign_number does, unless a size error occurs:
+ * a size error occurs when the value's integer digits do not fit the assignee's length. Fractional digits beyond the
+ * assignee's scale are truncated without a size error.
+ * @param assignee The number to assign the specified value to. Left unchanged on a size error.
+ * @param value The number to assign.
+ * @return Returns false iff a size error occurred.
+ */
+bool bstd_assign_number_checked(bstd_number* assignee, const bstd_number* value);
+
+/**
+ * Assigns the specified 64-bit integer to the specified number as bstd_assign_int64 does, unless a size error occurs.
+ * @param number The number to assign the specified integer to. Left unchanged on a size error.
+ * @param value The integer to assign.
+ * @return Returns false iff the integer does not fit the number's length.
+ */
+bool bstd_assign_int64_checked(bstd_number* number, int64_t value);
+
 /**
  * Assigns the specified double to the specified bstd_number, following the BabyCobol assignment specifications.
  * @param number The number to assign the specified double to.
@@ -76,12 +121,30 @@ void bstd_assign_int64(bstd_number* number, int64_t value);
 void bstd_assign_double(bstd_number* number, double value);
 
 /**
- * todo: remove; bstd_number_to_cstr is sufficient
- * @param number
- * @param advancing
+ * Prints the specified number to stdout the way DISPLAY shows it, as formatted by bstd_number_format_into:
+ * zero-padded to the number's length, with a leading sign if it is signed.
+ * @param number The number to print.
+ * @param advancing If true, the number is preceded by a space.
  */
 void bstd_print_number(bstd_number number, bool advancing);
 
+/**
+ * Compares the specified numbers exactly. Scales are aligned without loss, so 1.2 < 1.9 and 1.5 == 1.50.
+ * @param lhs The left-hand side of the comparison.
+ * @param rhs The right-hand side of the comparison.
+ * @return Returns -1 if lhs < rhs, 0 if lhs == rhs and 1 if lhs > rhs.
+ */
+int bstd_number_compare(const bstd_number* lhs, const bstd_number* rhs);
+
+/**
+ * Writes a fixed-width sort key for the specified number: comparing two keys with memcmp orders them as bstd_number_compare does.
+ * Keys are normalized, so numbers of equal value produce identical keys regardless of their constraints.
+ * The key holds a sign byte followed by the big-endian integer part and the fraction normalized to 19 digits; negative numbers complement the latter.
+ * @param number The number to create a sort key for. Its scale may not exceed 19.
+ * @param key The buffer to write the key to. Must hold at least BSTD_NUMBER_SORT_KEY_SIZE bytes.
+ */
+void bstd_number_sort_key(const bstd_number* number, unsigned char* key);
+
 /**
  * Determines whether the specified {@link lhs} is strictly greater than the specified {@link rhs}.
  * @param lhs The left-hand side of the infix ">" operator.
@@ -100,14 +163,48 @@ bool bstd_less_than(const bstd_number* lhs, const bstd_number* rhs);
 
 /**
  * Determines whether the specified {@link lhs} is equal to the specified {@link rhs}.
- * Two numbers are considered equal iff their integer representations are equal.
+ * Two numbers are considered equal iff their values are equal, regardless of their constraints.
  * @example lhs PICTURE IS S99. rhs PICTURE IS 9. Then assigning 3 to both, we get +03 = 3 which evaluates to true.
- * @param lhs The left-hand side of the infix "<" operator.
- * @param rhs The right-hand side of the infix "<" operator.
- * @return Returns true iff the integer representations of lhs and rhs are equal.
+ * @param lhs The left-hand side of the infix "=" operator.
+ * @param rhs The right-hand side of the infix "=" operator.
+ * @return Returns true iff the values of lhs and rhs are equal.
  */
 bool bstd_number_equals(const bstd_number* lhs, const bstd_number* rhs);
 
+/**
+ * Formats the specified number into the specified buffer, the way DISPLAY shows a numeric field.
+ * All of the number's digits are written, padded with leading zeros, with a decimal point before the fractional digits.
+ * Signed numbers are preceded by their sign ('+' or '-'); unsigned numbers have none. The result is null-terminated.
+ * @example A number PICTURE IS S9(3)V99 holding -1.5 is formatted as "-001.50".
+ * @param buf The buffer to write to.
+ * @param cap The capacity of the buffer. BSTD_NUMBER_FORMAT_MAX_SIZE always suffices.
+ * @param number The number to format. Its length and scale may not exceed 19.
+ * @return Returns the length of the formatted number, excluding the terminator. If that length is not less than cap, nothing is written.
+ * Returns BSTD_NUMBER_FORMAT_ERROR without writing anything if the number has more than 19 digits.
+ */
+size_t bstd_number_format_into(char* buf, size_t cap, const bstd_number* number);
+
+/**
+ * Parses the specified decimal text and assigns its value to the specified number, following the BabyCobol assignment specifications.
+ * The text consists of an optional sign ('+' or '-'), digits and an optional decimal point, and may be surrounded by spaces.
+ * Up to 19 digits are accepted before the decimal point, disregarding leading zeros; fractional digits beyond the number's scale are truncated.
+ * @param number The number to assign the parsed value to. Left unchanged if the text is invalid.
+ * @param str The text to parse. Need not be null-terminated.
+ * @param len The number of characters of the text.
+ * @return Returns true iff the text represents a valid number.
+ */
+bool bstd_number_parse(bstd_number* number, const char* str, size_t len);
+
+/**
+ * Parses a column of fixed-width decimal text fields into the specified numbers, as bstd_number_parse does for every field.
+ * @param numbers The numbers to assign the parsed values to. Numbers of invalid fields are left unchanged.
+ * @param data The fields, stored back to back.
+ * @param width The width of every field.
+ * @param n The number of fields.
+ * @return Returns the number of fields that were parsed successfully.
+ */
+size_t bstd_number_parse_n(bstd_number* numbers, const char* data, size_t width, size_t n);
+
 /**
  * todo: rename to bstd_number_to_str to be consistent with bstd_picture_to_str
  * @param number
@@ -115,6 +212,14 @@ bool bstd_number_equals(const bstd_number* lhs, const bstd_number* rhs);
  */
 char* bstd_number_to_cstr(bstd_number number);
 
+/**
+ * Converts the specified number to a string allocated in the specified arena, as bstd_number_to_cstr does.
+ * @param arena The arena to allocate the string from; NULL allocates it with the current allocator.
+ * @param number The number to convert.
+ * @return Returns the string, released with its arena.
+ */
+char* bstd_number_to_cstr_arena(bstd_arena* arena, bstd_number number);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
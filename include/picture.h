@@ -1,10 +1,72 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
+/**
+ * A maximal run of equal mask characters within a picture mask.
+ */
+typedef struct bstd_mask_run_t {
+    uint8_t start;
+    uint8_t length;
+    char mask;
+} bstd_mask_run;
+
+/**
+ * The compiled layout of a picture mask: its mask characters as consecutive runs, so that operations
+ * process a picture run by run instead of byte by byte. X(30)9(8)A(10) compiles to three runs.
+ */
+typedef struct bstd_picture_layout_t {
+    uint8_t count;
+    bool interned;
+    bstd_mask_run runs[];
+} bstd_picture_layout;
+
+/**
+ * Gets the size in bytes of a layout of the specified number of runs.
+ */
+#define BSTD_PICTURE_LAYOUT_SIZE(runs) (sizeof(bstd_picture_layout) + sizeof(bstd_mask_run) * (runs))
+
+/**
+ * The largest picture whose bytes fit a bstd_picture_storage.
+ */
+#define BSTD_PICTURE_INLINE_SIZE 24
+
+/**
+ * A BabyCobol PICTURE value: its bytes under a mask of equal length.
+ * Pictures created by the library are a single allocation that holds their bytes in data, so bytes == data;
+ * release them with bstd_free. They share an interned copy of their mask and its compiled layout with every picture of
+ * the same mask; interned masks are immutable, live until the program exits and are allocated with malloc, outside the
+ * hooks of bstd_set_allocator. The mask is read-only, as other pictures may share it.
+ * Pictures without a layout (NULL) are compiled on the fly by every operation; the library creates such pictures, holding
+ * a copy of their mask after their bytes, only if their mask could not be interned. Pictures that the caller builds over
+ * its own bytes and mask have no layout either; initialize them with BSTD_PICTURE_INIT rather than field by field.
+ */
 typedef struct bstd_picture_t {
     unsigned char *bytes;
-    char *mask;
+    const char *mask;
     uint8_t length;
+    const bstd_picture_layout *layout;
+    unsigned char data[];
+} bstd_picture;
+
+/**
+ * Initializes a picture over bytes and a mask that the caller owns, without a layout:
+ * bstd_picture picture = BSTD_PICTURE_INIT(bytes, mask, length);
+ */
+#define BSTD_PICTURE_INIT(bytes, mask, length) { (bytes), (mask), (length), NULL }
+
+/**
+ * Gets the size in bytes of a picture that holds the specified number of bytes inline.
+ */
+#define BSTD_PICTURE_SIZE(length) (sizeof(bstd_picture) + (length))
 
-} bstd_picture;
\ No newline at end of file
+/**
+ * Storage for a picture of at most BSTD_PICTURE_INLINE_SIZE bytes, such as a local variable. It holds a structure with a
+ * flexible array member, so ISO C does not allow it as a member of another structure or an element of an array.
+ * Initialize it with bstd_picture_init_in; the picture needs no allocation.
+ */
+typedef union bstd_picture_storage_t {
+    bstd_picture picture;
+    unsigned char bytes[BSTD_PICTURE_SIZE(BSTD_PICTURE_INLINE_SIZE)];
+} bstd_picture_storage;
@@ -2,6 +2,7 @@
 
 #include <stdbool.h>
 #include "picture.h"
+#include "arena.h"
 #include <stddef.h>
 
 #ifndef BSTD_PICTURE_MASKS
@@ -20,31 +21,61 @@ extern "C" {
 #endif // __cplusplus
 
 /**
- * Creates a new bstd_picture struct with a copy of the specified mask string.
+ * Creates a new bstd_picture struct for the specified mask string.
  * The new bstd_picture's bytes are initialized with default values under its mask.
+ * The picture and its bytes are a single allocation; release it with bstd_free.
+ * The picture shares an interned, immutable copy of the mask with every picture of the same mask.
  * Note: the caller still owns the mask string.
  * @param mask The mask for which to create the picture.
- * @return Returns a new bstd_picture struct with default bytes under the specified mask.
+ * @return Returns a new bstd_picture struct with default bytes under the specified mask, or NULL if it could not be allocated.
  */
 bstd_picture* bstd_create_picture(char *mask_str);
 
+/**
+ * Creates a new bstd_picture in the specified arena, as bstd_create_picture does.
+ * The picture and its bytes are a single allocation from the arena and are released with it; its mask is interned.
+ * @param arena The arena to allocate the picture from; NULL allocates it with the current allocator.
+ * @param mask The mask for which to create the picture.
+ * @return Returns a new bstd_picture struct with default bytes under the specified mask, or NULL if it could not be allocated.
+ */
+bstd_picture* bstd_create_picture_arena(bstd_arena *arena, char *mask_str);
+
  /**
-* Creates a new bstd_picture struct containing direct copies of the specified bytes and mask parameters.
+* Creates a new bstd_picture struct containing a direct copy of the specified bytes and the interned copy of the specified mask.
 * Bytes are copied directly and are not checked of their validity under the specified mask.
 * Note: The caller still owns the bytes and mask pointers and they may safely be freed (the picture contains copies).
 * @param bytes The bytes to copy into the new bstd_picture.
 * @param mask The mask to copy into the new bstd_picture.
 * @param length The length of the new bstd_picture.
-* @return Returns a new bstd_picture struct populated with direct copies of the specified bytes and mask.
+* @return Returns a new bstd_picture struct populated with direct copies of the specified bytes and mask, or NULL if it could not be allocated.
 */
 bstd_picture *bstd_picture_of(unsigned char *bytes, char *mask, uint8_t length);
 
+/**
+* Creates a new bstd_picture in the specified arena, as bstd_picture_of does.
+* @param arena The arena to allocate the picture from; NULL allocates it with the current allocator.
+* @param bytes The bytes to copy into the new bstd_picture.
+* @param mask The mask to copy into the new bstd_picture.
+* @param length The length of the new bstd_picture.
+* @return Returns a new bstd_picture struct, released with its arena, or NULL if it could not be allocated.
+*/
+bstd_picture *bstd_picture_of_arena(bstd_arena *arena, unsigned char *bytes, char *mask, uint8_t length);
+
 /**
  * Initializes the content of this picture with the appropriate default values for its mask.
  * @param picture The picture to initialize.
  */
 void bstd_picture_init(bstd_picture* picture);
 
+/**
+ * Initializes a picture for the specified mask string in the specified storage, with default bytes under its mask.
+ * The picture is not allocated and needs no release; it lives as long as its storage.
+ * @param storage The storage to initialize the picture in.
+ * @param mask_str The mask of the picture. At most BSTD_PICTURE_INLINE_SIZE characters.
+ * @return Returns the picture, or NULL if the mask does not fit the storage or could not be interned.
+ */
+bstd_picture* bstd_picture_init_in(bstd_picture_storage *storage, const char *mask_str);
+
 /**
 * Copies the content of the specified value picture to the specified assignee.
 * TODO: Should ensure that the representation of both pictures is correct under their mask.
@@ -61,6 +92,14 @@ void bstd_assign_picture(bstd_picture *assignee, const bstd_picture *value);
 */
 char *bstd_picture_to_cstr(const bstd_picture *picture); // todo: rename to bstd_picture_to_str
 
+/**
+* Creates a C-style string representation of the specified picture in the specified arena, as bstd_picture_to_cstr does.
+* @param arena The arena to allocate the string from; NULL allocates it with the current allocator.
+* @param picture The picture to create a C-style string representation of.
+* @return Returns a C-style string representation of the specified picture, released with its arena.
+*/
+char *bstd_picture_to_cstr_arena(bstd_arena *arena, const bstd_picture *picture);
+
 /**
 * Assigns the specified c-style string to the specified picture.
 * Assigned strings are converted according to the picture's constraints. This is the inverse of bstd_picture_to_cstr.
@@ -69,6 +108,15 @@ char *bstd_picture_to_cstr(const bstd_picture *picture); // todo: rename to bstd
 */
 void bstd_assign_str(bstd_picture *assignee, const char *str);
 
+/**
+ * Writes a fixed-width sort key for the specified picture: comparing two keys with memcmp orders the pictures by their masked characters.
+ * Pictures shorter than the key are padded with spaces and longer pictures are cut off, as in alphanumeric comparisons.
+ * @param picture The picture to create a sort key for.
+ * @param key The buffer to write the key to. Must hold at least width bytes.
+ * @param width The width of the key. Keys compared with each other must share the same width.
+ */
+void bstd_picture_sort_key(const bstd_picture *picture, unsigned char *key, size_t width);
+
 /**
  * Gets the default value for the specified mask.
  * @param mask The mask for which to get the default value.
@@ -95,11 +143,11 @@ char bstd_mask(unsigned char byte, char mask);
 unsigned char bstd_unmask(char c, char mask);
 
 /**
- *  todo: remove; bstd_picture_to_cstr is sufficient.
- * @param picture
- * @param advancing
+ * Prints the specified picture to stdout, as converted by bstd_picture_to_cstr.
+ * @param picture The picture to print.
+ * @param advancing If true, the picture is preceded by a space.
  */
-void bstd_print_picture(bstd_picture picture, bool advancing);
+void bstd_print_picture(const bstd_picture *picture, bool advancing);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BSTD_WIDE_NUMBER_MAX_LENGTH 38
+
+/**
+ * This is a complete representation of a BabyCobol numeric value of up to 38 digits, such as PIC S9(31)V99.
+ * It mirrors bstd_number, but holds its value in a 128-bit integer.
+ * Prefer bstd_number for values of up to 18 digits; it is the faster representation.
+ */
+typedef struct bstd_wide_number_t {
+    unsigned __int128 value;
+    uint64_t scale;
+    uint8_t length;
+    bool isSigned;
+    bool positive;
+} bstd_wide_number;
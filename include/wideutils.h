@@ -0,0 +1,123 @@
+#pragma once
+
+#include "number.h"
+#include "wide_number.h"
+#include "arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Assigns the specified wide number to the specified wide assignee. If the numbers' constraints do not match, the assignee's constraints are leading.
+ * @param assignee The wide number to assign the specified value to.
+ * @param value The wide number to assign.
+ */
+void bstd_wide_assign(bstd_wide_number* assignee, const bstd_wide_number* value);
+
+/**
+ * Assigns the specified number to the specified wide assignee. The assignee's constraints are leading.
+ * @param assignee The wide number to assign the specified value to.
+ * @param value The number to assign.
+ */
+void bstd_wide_assign_number(bstd_wide_number* assignee, const bstd_number* value);
+
+/**
+ * Assigns the specified 64-bit integer to the specified wide number, following the BabyCobol assignment specifications.
+ * @param number The wide number to assign the specified integer to.
+ * @param value The integer to assign to the specified wide number.
+ */
+void bstd_wide_assign_int64(bstd_wide_number* number, int64_t value);
+
+/**
+ * Assigns the specified wide number to the specified (narrow) assignee. The assignee's constraints are leading,
+ * so high-order digits that do not fit the assignee are cropped.
+ * @param assignee The number to assign the specified value to.
+ * @param value The wide number to assign.
+ */
+void bstd_assign_wide(bstd_number* assignee, const bstd_wide_number* value);
+
+/**
+ * Sums the specified left- and right-hand sides, and assigns the result to the specified left-hand side.
+ * The result is truncated to the left-hand side's scale, and high-order digits that do not fit its length are cropped.
+ * This function does not modify the right-hand side.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ */
+void bstd_wide_add(bstd_wide_number *lhs, const bstd_wide_number *rhs);
+
+/**
+ * Subtracts the specified right-hand side from the specified left-hand side, and assigns the result to the left-hand side.
+ * The result is truncated to the left-hand side's scale, and high-order digits that do not fit its length are cropped.
+ * This function does not modify the right-hand side.
+ * @param lhs The left-hand side of the subtraction.
+ * @param rhs The right-hand side of the subtraction.
+ */
+void bstd_wide_subtract(bstd_wide_number *lhs, const bstd_wide_number *rhs);
+
+/**
+ * Sums the specified wide left-hand side and (narrow) right-hand side, and assigns the result to the left-hand side.
+ * This is the fast path for accumulating 18-digit numbers into a wide total.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ */
+void bstd_wide_add_number(bstd_wide_number *lhs, const bstd_number *rhs);
+
+/**
+ * Subtracts the specified (narrow) right-hand side from the specified wide left-hand side, and assigns the result to the left-hand side.
+ * @param lhs The left-hand side of the subtraction.
+ * @param rhs The right-hand side of the subtraction.
+ */
+void bstd_wide_subtract_number(bstd_wide_number *lhs, const bstd_number *rhs);
+
+/**
+ * Compares the specified wide numbers exactly, regardless of their scales.
+ * @param lhs The left-hand side of the comparison.
+ * @param rhs The right-hand side of the comparison.
+ * @return Returns -1 if lhs < rhs, 0 if lhs == rhs and 1 if lhs > rhs.
+ */
+int bstd_wide_compare(const bstd_wide_number* lhs, const bstd_wide_number* rhs);
+
+/**
+ * Determines whether the specified {@link lhs} is strictly greater than the specified {@link rhs}.
+ * @param lhs The left-hand side of the infix ">" operator.
+ * @param rhs The right-hand side of the infix ">" operator.
+ * @return Returns true iff lhs > rhs.
+ */
+bool bstd_wide_greater_than(const bstd_wide_number* lhs, const bstd_wide_number* rhs);
+
+/**
+ * Determines whether the specified {@link lhs} is strictly less than the specified {@link rhs}.
+ * @param lhs The left-hand side of the infix "<" operator.
+ * @param rhs The right-hand side of the infix "<" operator.
+ * @return Returns true iff lhs < rhs.
+ */
+bool bstd_wide_less_than(const bstd_wide_number* lhs, const bstd_wide_number* rhs);
+
+/**
+ * Determines whether the specified {@link lhs} is equal to the specified {@link rhs}.
+ * @param lhs The left-hand side of the infix "=" operator.
+ * @param rhs The right-hand side of the infix "=" operator.
+ * @return Returns true iff lhs and rhs represent the same value.
+ */
+bool bstd_wide_equals(const bstd_wide_number* lhs, const bstd_wide_number* rhs);
+
+/**
+ * Creates a C-style string representation of the specified wide number.
+ * The representation follows the format of bstd_number_to_cstr.
+ * @param number The wide number to create a C-style string representation of.
+ * @return Returns a C-style string representation of the specified wide number.
+ */
+char* bstd_wide_to_cstr(const bstd_wide_number* number);
+
+/**
+ * Creates a C-style string representation of the specified wide number in the specified arena, as bstd_wide_to_cstr does.
+ * @param arena The arena to allocate the string from; NULL allocates it with the current allocator.
+ * @param number The wide number to create a C-style string representation of.
+ * @return Returns a C-style string representation of the specified wide number, released with its arena.
+ */
+char* bstd_wide_to_cstr_arena(bstd_arena* arena, const bstd_wide_number* number);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
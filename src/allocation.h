@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stddef.h>
+#include "../include/arena.h"
+#include "../include/allocator.h"
+
+/**
+ * Allocates memory for a library object, from the specified arena or, without an arena, with the allocator set by bstd_set_allocator.
+ * Every allocating function of the library allocates through this function; release the memory with bstd_free.
+ * @param arena The arena to allocate from, or NULL to allocate with the current allocator.
+ * @param size The number of bytes to allocate.
+ * @return Returns the allocated memory.
+ */
+void* bstd_allocate(bstd_arena *arena, size_t size);
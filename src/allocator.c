@@ -0,0 +1,88 @@
+#include <stdlib.h>
+#include "../include/allocator.h"
+#include "allocation.h"
+
+static void* default_alloc(void *ctx, size_t size) {
+    (void) ctx;
+    return malloc(size);
+}
+
+static void* default_realloc(void *ctx, void *ptr, size_t size) {
+    (void) ctx;
+    return realloc(ptr, size);
+}
+
+static void default_free(void *ctx, void *ptr) {
+    (void) ctx;
+    free(ptr);
+}
+
+/**
+ * The allocator every allocation outside of an arena goes through.
+ */
+static bstd_allocator global_allocator = {
+    .alloc = default_alloc,
+    .realloc = default_realloc,
+    .free = default_free,
+    .ctx = NULL
+};
+
+void bstd_set_allocator(bstd_alloc_fn alloc, bstd_realloc_fn realloc, bstd_free_fn free, void *ctx) {
+
+    if (alloc == NULL) {
+        global_allocator = (bstd_allocator) { default_alloc, default_realloc, default_free, NULL };
+        return;
+    }
+
+    global_allocator = (bstd_allocator) { alloc, realloc, free, ctx };
+}
+
+const bstd_allocator* bstd_get_allocator(void) {
+    return &global_allocator;
+}
+
+void bstd_free(void *ptr) {
+    if (ptr != NULL) {
+        global_allocator.free(global_allocator.ctx, ptr);
+    }
+}
+
+void* bstd_allocate(bstd_arena *arena, size_t size) {
+    return arena != NULL ? bstd_arena_alloc(arena, size) : global_allocator.alloc(global_allocator.ctx, size);
+}
+
+void bstd_allocation_counter_init(bstd_allocation_counter *counter) {
+    counter->allocations = 0;
+    counter->reallocations = 0;
+    counter->frees = 0;
+    counter->bytes = 0;
+    counter->parent = global_allocator;
+}
+
+void* bstd_counting_alloc(void *ctx, size_t size) {
+
+    bstd_allocation_counter *counter = ctx;
+
+    counter->allocations++;
+    counter->bytes += size;
+
+    return counter->parent.alloc(counter->parent.ctx, size);
+}
+
+void* bstd_counting_realloc(void *ctx, void *ptr, size_t size) {
+
+    bstd_allocation_counter *counter = ctx;
+
+    counter->reallocations++;
+    counter->bytes += size;
+
+    return counter->parent.realloc(counter->parent.ctx, ptr, size);
+}
+
+void bstd_counting_free(void *ctx, void *ptr) {
+
+    bstd_allocation_counter *counter = ctx;
+
+    counter->frees++;
+    counter->parent.free(counter->parent.ctx, ptr);
+}
@@ -0,0 +1,91 @@
+#include "../include/arena.h"
+
+/**
+ * The alignment of every allocation from an arena.
+ */
+#define ARENA_ALIGNMENT 16
+
+/**
+ * Allocates a new, empty chunk that holds at least the specified number of bytes.
+ */
+static bstd_arena_chunk* create_chunk(const bstd_allocator *allocator, size_t size) {
+
+    bstd_arena_chunk *chunk = allocator->alloc(allocator->ctx, sizeof(bstd_arena_chunk) + size);
+
+    if (chunk != NULL) {
+        chunk->next = NULL;
+        chunk->size = size;
+        chunk->used = 0;
+    }
+
+    return chunk;
+}
+
+void bstd_arena_init(bstd_arena *arena, size_t chunk_size) {
+    bstd_arena_init_with_allocator(arena, chunk_size, bstd_get_allocator());
+}
+
+void bstd_arena_init_with_allocator(bstd_arena *arena, size_t chunk_size, const bstd_allocator *allocator) {
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->chunk_size = chunk_size == 0 ? BSTD_ARENA_DEFAULT_CHUNK_SIZE : chunk_size;
+    arena->allocator = *allocator;
+}
+
+void* bstd_arena_alloc(bstd_arena *arena, size_t size) {
+
+    const size_t aligned = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+    bstd_arena_chunk *chunk = arena->current;
+
+    if (chunk != NULL && chunk->size - chunk->used >= aligned) {
+        void *memory = chunk->data + chunk->used;
+        chunk->used += aligned;
+        return memory;
+    }
+
+    // reuse the next chunk kept by a reset if it is large enough, or insert a new one
+    bstd_arena_chunk *next = chunk != NULL ? chunk->next : arena->head;
+
+    if (next == NULL || next->size < aligned) {
+        bstd_arena_chunk *created = create_chunk(&arena->allocator, aligned > arena->chunk_size ? aligned : arena->chunk_size);
+        if (created == NULL) {
+            return NULL;
+        }
+        created->next = next;
+        if (chunk != NULL) {
+            chunk->next = created;
+        } else {
+            arena->head = created;
+        }
+        next = created;
+    }
+
+    next->used = aligned;
+    arena->current = next;
+
+    return next->data;
+}
+
+void bstd_arena_reset(bstd_arena *arena) {
+
+    if (arena->head != NULL) {
+        arena->head->used = 0;
+    }
+
+    // the remaining chunks are emptied as the arena advances into them again
+    arena->current = arena->head;
+}
+
+void bstd_arena_destroy(bstd_arena *arena) {
+
+    bstd_arena_chunk *chunk = arena->head;
+
+    while (chunk != NULL) {
+        bstd_arena_chunk *next = chunk->next;
+        arena->allocator.free(arena->allocator.ctx, chunk);
+        chunk = next;
+    }
+
+    arena->head = NULL;
+    arena->current = NULL;
+}
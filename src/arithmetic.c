@@ -1,7 +1,9 @@
 #include "../include/arithmetic.h"
 #include "../include/numutils.h"
+#include "decimal.h"
+#include "allocation.h"
+#include "kernels.h"
 #include <stdlib.h>
-#include <math.h>
 
 uint64_t max(uint64_t a, uint64_t b) {
     return a > b ? a : b;
@@ -22,138 +24,623 @@ int64_t ipow(int64_t base, uint64_t exp) {
     return result;
 }
 
-static int64_t number_to_signed_value(const bstd_number* number) {
-    return !number->positive && number->isSigned ? -number->value : number->value;
+/**
+ * Stores the specified scaled result of a computation in the specified output number.
+ * The output takes on the result's own constraints; results of more than 18 digits keep their 18 least-significant digits.
+ * @param out The number to store the result in.
+ * @param result The result to store.
+ * @param scale The scale of the specified result.
+ */
+static void store_result(bstd_number *out, __int128 result, uint64_t scale) {
+
+    unsigned __int128 magnitude = bstd_abs_i128(result);
+    uint8_t length = bstd_digit_count_u128(magnitude);
+
+    if (length > BSTD_RESULT_MAX_DIGITS) {
+        length = BSTD_RESULT_MAX_DIGITS;
+        magnitude %= bstd_pow10_table[BSTD_RESULT_MAX_DIGITS];
+    }
+
+    out->value = (uint64_t) magnitude;
+    out->scale = scale;
+    out->positive = result >= 0 || magnitude == 0;
+    out->isSigned = !out->positive;
+    out->length = length;
 }
 
-void bstd_add(bstd_number *lhs, const bstd_number *rhs) {
-    const bstd_number* sum = bstd_sum(lhs, rhs);
-    bstd_assign_number(lhs, sum);
-    free((void*)sum);
+/**
+ * Adds the specified double to the specified number. The exact sum is truncated towards zero at the number's scale.
+ * @param lhs The left-hand side of the addition.
+ * @param rhs The right-hand side of the addition.
+ */
+static void add_double(bstd_number *lhs, double rhs) {
+
+    const double shifted = rhs * (double) bstd_pow10_table[lhs->scale];
+    const int64_t whole = (int64_t) shifted;
+    const double fraction = shifted - (double) whole;
+
+    __int128 sum = bstd_signed_value(lhs) + whole;
+
+    // the fraction dropped from rhs still pulls the sum towards zero if it has the opposite sign
+    if (sum > 0 && fraction < 0) {
+        sum -= 1;
+    } else if (sum < 0 && fraction > 0) {
+        sum += 1;
+    }
+
+    bstd_store_scaled(lhs, sum);
 }
 
-bstd_number* bstd_sum(const bstd_number *lhs, const bstd_number *rhs) {
+/**
+ * Divides the specified value by the specified prepared divisor, using its reciprocal multiplier.
+ * @param divisor The prepared divisor. Must not be zero.
+ * @param n The value to divide.
+ * @return Returns n / divisor->value, truncated.
+ */
+static uint64_t reciprocal_divide(const bstd_divisor *divisor, uint64_t n) {
+
+    if (!divisor->magic) {
+        // powers of two need only the shift
+        return n >> divisor->shift;
+    }
+
+    const uint64_t q = (uint64_t) (((unsigned __int128) divisor->magic * n) >> 64);
+
+    if (divisor->add) {
+        // the magic number needed 65 bits; the implicit top bit is added back without overflowing
+        return (((n - q) >> 1) + q) >> divisor->shift;
+    }
+
+    return q >> divisor->shift;
+}
+
+/**
+ * Computes (value * 10^exp) / divisor by long division, a batch of up to 19 decimal digits per step, for exponents whose
+ * scaled value does not fit 128 bits. Every step scales a remainder smaller than the divisor, so no step overflows.
+ * @param value The value to divide.
+ * @param exp The exponent of the power of ten to scale the value by. Larger than 19.
+ * @param divisor The divisor. Must not be zero.
+ * @return Returns the quotient modulo 10^38; the digits beyond that would be cropped by any receiving number.
+ */
+static unsigned __int128 long_divide_pow10(uint64_t value, uint64_t exp, uint64_t divisor) {
+
+    unsigned __int128 quotient = value / divisor;
+    uint64_t remainder = value % divisor;
+
+    while (exp > 0) {
+        const uint64_t step = exp < BSTD_POW10_MAX_EXP ? exp : BSTD_POW10_MAX_EXP;
+        const unsigned __int128 numerator = (unsigned __int128) remainder * bstd_pow10_table[step];
+        // dropping the digits beyond 10^38 first keeps the shifted quotient below 10^38
+        quotient = (quotient % bstd_pow10_u128(2 * BSTD_POW10_MAX_EXP - step)) * bstd_pow10_table[step] + numerator / divisor;
+        remainder = (uint64_t) (numerator % divisor);
+        exp -= step;
+    }
+
+    return quotient;
+}
+
+/**
+ * Computes the magnitude of the quotient of the specified dividend and divisor at the specified scale, truncated towards zero.
+ * @param dividend The dividend.
+ * @param divisor The prepared divisor. Must not be zero.
+ * @param scale The scale of the quotient.
+ * @param reciprocal If true, the divisor's reciprocal multiplier is used where possible.
+ * @return Returns the magnitude of the quotient at the specified scale, modulo 10^38.
+ */
+static unsigned __int128 quotient_magnitude(const bstd_number *dividend, const bstd_divisor *divisor, uint64_t scale, bool reciprocal) {
+
+    // a / b at scale s equals (a * 10^(sb + s - sa)) / b, where the exponent may also be negative:
+    // truncating a / 10^m first is exact, because floor(floor(a / 10^m) / b) == floor(a / (10^m * b))
+    const uint64_t exp = divisor->scale + scale;
+
+    if (exp >= dividend->scale && exp - dividend->scale > BSTD_POW10_MAX_EXP) {
+        // a * 10^20 and up may not fit 128 bits
+        return long_divide_pow10(dividend->value, exp - dividend->scale, divisor->value);
+    }
+
+    const unsigned __int128 numerator = exp >= dividend->scale
+            ? (unsigned __int128) dividend->value * bstd_pow10_table[exp - dividend->scale]
+            : bstd_div_pow10_u128(dividend->value, dividend->scale - exp);
+
+    if (numerator > UINT64_MAX) {
+        return numerator / divisor->value;
+    }
+
+    if (reciprocal) {
+        return reciprocal_divide(divisor, (uint64_t) numerator);
+    }
+
+    return (uint64_t) numerator / divisor->value;
+}
+
+/**
+ * Divides the specified dividend by the specified divisor, following the BabyCobol DIVIDE specifications.
+ * All operands are read before any result is stored, so the quotient and remainder may alias the dividend.
+ * @param quotient The number to store the quotient in.
+ * @param remainder The number to store the remainder in, or NULL if no remainder is required.
+ * @param dividend The dividend.
+ * @param divisor The prepared divisor.
+ * @param reciprocal If true, the divisor's reciprocal multiplier is used where possible.
+ */
+static void divide(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_divisor *divisor, bool reciprocal) {
+
+    if (divisor->value == 0) {
+        // size error: the receiving numbers are left unchanged
+        return;
+    }
 
-    uint64_t s = max(lhs->scale, rhs->scale);
-    int64_t a = number_to_signed_value(lhs) * ipow(10, (int64_t)((-lhs->scale) + s));
-    int64_t b = number_to_signed_value(rhs) * ipow(10, (int64_t)((-rhs->scale) + s));
-    int64_t result = a + b;
-    uint64_t length = result == 0 ? 1 : (uint64_t)ceill(log10l(labs(result)));
+    const __int128 magnitude = (__int128) quotient_magnitude(dividend, divisor, quotient->scale, reciprocal);
+    const __int128 q = bstd_is_negative(dividend) != divisor->negative ? -magnitude : magnitude;
 
-    if (length > 18){
-        int overflow = ((int)length) - 18;
-        length = 18;
-        result = result % (int64_t)ipow(10, floor(log10((double)result) - overflow + 1));
+    // the exact quotient fits the quotient's length iff a / b * 10^sq < 10^length, i.e. a / 10^(sa + length) < b / 10^(sb + sq)
+    if (remainder && bstd_compare_magnitudes(dividend->value, dividend->scale + quotient->length,
+                                             divisor->value, divisor->scale + quotient->scale) < 0) {
+
+        // dividend - quotient * divisor at scale max(sa, sq + sb): the remainder of an exact quotient is smaller than
+        // both the divisor at that scale and the dividend, so it fits and the wrapping unsigned arithmetic below is exact
+        const uint64_t qb_scale = quotient->scale + divisor->scale;
+        const uint64_t s = max(dividend->scale, qb_scale);
+        const unsigned __int128 a = (unsigned __int128) bstd_signed_value(dividend) * bstd_pow10_u128(s - dividend->scale);
+        const unsigned __int128 qb = (unsigned __int128) q * divisor->value * bstd_pow10_u128(s - qb_scale);
+        const __int128 r = (__int128) (divisor->negative ? a + qb : a - qb);
+
+        bstd_store_scaled(quotient, q);
+        bstd_store_scaled(remainder, bstd_rescale(r, s, remainder->scale));
+
+    } else {
+        // on a size error, the quotient is cropped; the remainder of a cropped quotient is meaningless and left unchanged
+        bstd_store_scaled(quotient, q);
+    }
+}
+
+/**
+ * Wraps the specified number as a divisor without computing its reciprocal multiplier.
+ * @param number The number to divide by.
+ * @return Returns a divisor that may only be used for plain division.
+ */
+static bstd_divisor plain_divisor(const bstd_number *number) {
+    return (bstd_divisor) {
+        .value = number->value,
+        .scale = number->scale,
+        .negative = bstd_is_negative(number),
+        .magic = 0,
+        .shift = 0,
+        .add = false
+    };
+}
+
+/**
+ * The number of elements a batch operation packs into contiguous values before handing them to a kernel.
+ */
+#define BATCH_BLOCK_SIZE 256
+
+/**
+ * Determines whether a batch can be processed by the kernels: every left-hand side must share the constraints of lhs[0],
+ * which fits 18 digits, and every right-hand side must share its scale and be no longer.
+ * @param lhs The left-hand sides of the batch.
+ * @param n The number of left-hand sides.
+ * @param rhs The right-hand sides of the batch.
+ * @param rhs_n The number of right-hand sides: n, or 1 for a single right-hand side.
+ * @return Returns true iff the kernels produce the same results as processing the batch element by element.
+ */
+static bool batchable(const bstd_number *lhs, size_t n, const bstd_number *rhs, size_t rhs_n) {
+
+    const uint8_t length = lhs->length;
+    const uint64_t scale = lhs->scale;
+    const bool isSigned = lhs->isSigned;
+
+    if (length > BSTD_RESULT_MAX_DIGITS) {
+        return false;
     }
 
-    bstd_number* number = (bstd_number*)malloc(sizeof(bstd_number));
-    number->value = (uint64_t)labs(result);
-    number->scale = s;
-    number->positive = result >= 0;
-    number->isSigned = !number->positive;
-    number->length = length;
+    for (size_t i = 0; i < n; ++i) {
+        if (lhs[i].length != length || lhs[i].scale != scale || lhs[i].isSigned != isSigned) {
+            return false;
+        }
+    }
 
+    for (size_t i = 0; i < rhs_n; ++i) {
+        if (rhs[i].scale != scale || rhs[i].length > length) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Adds or subtracts every rhs[i] to or from lhs[i] through the batch kernels, a block of elements at a time.
+ * @param lhs The left-hand sides, which receive the results.
+ * @param rhs The right-hand sides.
+ * @param n The number of elements in both arrays.
+ * @param subtract If true, the right-hand sides are subtracted instead of added.
+ */
+static void add_batch(bstd_number *lhs, const bstd_number *rhs, size_t n, bool subtract) {
+
+    const int64_t limit = (int64_t) bstd_pow10_table[lhs->length];
+    const bool isSigned = lhs->isSigned;
+    int64_t a[BATCH_BLOCK_SIZE];
+    int64_t b[BATCH_BLOCK_SIZE];
+
+    for (size_t base = 0; base < n; base += BATCH_BLOCK_SIZE) {
+
+        const size_t m = n - base < BATCH_BLOCK_SIZE ? n - base : BATCH_BLOCK_SIZE;
+
+        for (size_t i = 0; i < m; ++i) {
+            a[i] = (int64_t) bstd_signed_value(&lhs[base + i]);
+            b[i] = (int64_t) bstd_signed_value(&rhs[base + i]);
+        }
+
+        if (subtract) {
+            bstd_kernel_subtract(a, b, m, limit, isSigned);
+        } else {
+            bstd_kernel_add(a, b, m, limit, isSigned);
+        }
+
+        for (size_t i = 0; i < m; ++i) {
+            lhs[base + i].value = (uint64_t) (a[i] < 0 ? -a[i] : a[i]);
+            lhs[base + i].positive = !isSigned || a[i] >= 0;
+        }
+    }
+}
+
+void bstd_add(bstd_number *lhs, const bstd_number *rhs) {
+    bstd_number sum;
+    bstd_sum_into(&sum, lhs, rhs);
+    bstd_assign_number(lhs, &sum);
+}
+
+bstd_number* bstd_sum(const bstd_number *lhs, const bstd_number *rhs) {
+    return bstd_sum_arena(NULL, lhs, rhs);
+}
+
+bstd_number* bstd_sum_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs) {
+    bstd_number* number = (bstd_number*)bstd_allocate(arena, sizeof(bstd_number));
+    bstd_sum_into(number, lhs, rhs);
     return number;
 }
 
+void bstd_sum_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs) {
+
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 a = bstd_rescale(bstd_signed_value(lhs), lhs->scale, s);
+    const __int128 b = bstd_rescale(bstd_signed_value(rhs), rhs->scale, s);
+
+    store_result(out, a + b, s);
+}
+
 void bstd_subtract(bstd_number *lhs, const bstd_number *rhs) {
-    const bstd_number* difference = bstd_difference(lhs, rhs);
-    bstd_assign_number(lhs, difference);
-    free((void*)difference);
+    bstd_number difference;
+    bstd_difference_into(&difference, lhs, rhs);
+    bstd_assign_number(lhs, &difference);
 }
 
 bstd_number* bstd_difference(const bstd_number *lhs, const bstd_number *rhs) {
+    return bstd_difference_arena(NULL, lhs, rhs);
+}
 
-    uint64_t s = max(lhs->scale, rhs->scale);
-    int64_t a = number_to_signed_value(lhs) * ipow(10, (int64_t)((-lhs->scale) + s));
-    int64_t b = number_to_signed_value(rhs) * ipow(10, (int64_t)((-rhs->scale) + s));
-    int64_t result = a - b;
-    uint64_t length = result == 0 ? 1 : (uint64_t)ceill(log10l(labs(result)));
+bstd_number* bstd_difference_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs) {
+    bstd_number* number = (bstd_number*)bstd_allocate(arena, sizeof(bstd_number));
+    bstd_difference_into(number, lhs, rhs);
+    return number;
+}
 
-    if (length > 18){
-        int overflow = ((int)length) - 18;
-        length = 18;
-        result = result % (int64_t)ipow(10, floor(log10((double)result) - overflow + 1));
+void bstd_difference_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs) {
+
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 a = bstd_rescale(bstd_signed_value(lhs), lhs->scale, s);
+    const __int128 b = bstd_rescale(bstd_signed_value(rhs), rhs->scale, s);
+
+    store_result(out, a - b, s);
+}
+
+/**
+ * Adds the specified signed values to the specified left-hand side, unless the result does not fit its length.
+ * Operands of equal scale that fit 64 bits take an overflow-checked 64-bit path; all others are summed exactly in 128 bits.
+ * @param lhs The left-hand side of the addition, which receives the result.
+ * @param rhs The right-hand side of the addition.
+ * @param rhs_value The signed value of the right-hand side, negated for subtractions.
+ * @return Returns false iff a size error occurred.
+ */
+static bool add_checked(bstd_number *lhs, const bstd_number *rhs, __int128 rhs_value) {
+
+    const __int128 lhs_value = bstd_signed_value(lhs);
+    int64_t sum;
+
+    if (lhs->scale == rhs->scale && lhs->length <= BSTD_POW10_MAX_EXP
+        && rhs_value == (int64_t) rhs_value && lhs_value == (int64_t) lhs_value
+        && !__builtin_add_overflow((int64_t) lhs_value, (int64_t) rhs_value, &sum)) {
+
+        const uint64_t magnitude = sum < 0 ? -(uint64_t) sum : (uint64_t) sum;
+
+        if (magnitude >= bstd_pow10_table[lhs->length]) {
+            return false;
+        }
+
+        lhs->value = magnitude;
+        lhs->positive = !lhs->isSigned || sum >= 0;
+        return true;
     }
 
-    bstd_number* number = (bstd_number*)malloc(sizeof(bstd_number));
-    number->value = (uint64_t)labs(result);
-    number->scale = s;
-    number->positive = result >= 0;
-    number->isSigned = !number->positive;
-    number->length = length;
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 exact = bstd_rescale(lhs_value, lhs->scale, s) + bstd_rescale(rhs_value, rhs->scale, s);
+
+    return bstd_store_scaled_checked(lhs, bstd_rescale(exact, s, lhs->scale));
+}
+
+bool bstd_add_checked(bstd_number *lhs, const bstd_number *rhs) {
+    return add_checked(lhs, rhs, bstd_signed_value(rhs));
+}
+
+bool bstd_subtract_checked(bstd_number *lhs, const bstd_number *rhs) {
+    return add_checked(lhs, rhs, -bstd_signed_value(rhs));
+}
+
+bool bstd_multiply_checked(bstd_number *lhs, const bstd_number *rhs) {
+
+    const unsigned __int128 product = (unsigned __int128) lhs->value * rhs->value;
+    const __int128 magnitude = (__int128) bstd_div_pow10_u128(product, rhs->scale);
+
+    return bstd_store_scaled_checked(lhs, bstd_is_negative(lhs) != bstd_is_negative(rhs) ? -magnitude : magnitude);
+}
+
+void bstd_multiply(bstd_number *lhs, const bstd_number *rhs) {
+
+    // the exact product has scale lhs->scale + rhs->scale; dropping rhs->scale digits returns it to the scale of lhs
+    const unsigned __int128 product = (unsigned __int128) lhs->value * rhs->value;
+    const __int128 magnitude = (__int128) bstd_div_pow10_u128(product, rhs->scale);
+
+    bstd_store_scaled(lhs, bstd_is_negative(lhs) != bstd_is_negative(rhs) ? -magnitude : magnitude);
+}
+
+bstd_number* bstd_product(const bstd_number *lhs, const bstd_number *rhs) {
+    return bstd_product_arena(NULL, lhs, rhs);
+}
 
+bstd_number* bstd_product_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs) {
+    bstd_number* number = (bstd_number*)bstd_allocate(arena, sizeof(bstd_number));
+    bstd_product_into(number, lhs, rhs);
     return number;
 }
 
-void bstd_add_int(bstd_number *lhs, int64_t rhs) {
+void bstd_product_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs) {
 
-    if (bstd_number_is_integer(lhs)) {
+    uint64_t s = lhs->scale + rhs->scale;
+    unsigned __int128 product = (unsigned __int128) lhs->value * rhs->value;
 
-        const int64_t current = bstd_number_to_int(lhs);
-        const int64_t sum = current + rhs;
+    if (s > BSTD_RESULT_MAX_DIGITS) {
+        product = bstd_div_pow10_u128(product, s - BSTD_RESULT_MAX_DIGITS);
+        s = BSTD_RESULT_MAX_DIGITS;
+    }
 
-        bstd_assign_int64(lhs, sum);
+    const __int128 magnitude = (__int128) product;
 
-    } else {
+    store_result(out, bstd_is_negative(lhs) != bstd_is_negative(rhs) ? -magnitude : magnitude, s);
+}
 
-        const double current = bstd_number_to_double(lhs);
-        const double sum = current + rhs;
+void bstd_divide(bstd_number *lhs, const bstd_number *rhs) {
+    const bstd_divisor divisor = plain_divisor(rhs);
+    divide(lhs, NULL, lhs, &divisor, false);
+}
+
+bstd_number* bstd_quotient(const bstd_number *lhs, const bstd_number *rhs) {
+    return bstd_quotient_arena(NULL, lhs, rhs);
+}
 
-        bstd_assign_double(lhs, sum);
+bstd_number* bstd_quotient_arena(bstd_arena *arena, const bstd_number *lhs, const bstd_number *rhs) {
+
+    if (rhs->value == 0) {
+        return NULL;
     }
+
+    bstd_number* number = (bstd_number*)bstd_allocate(arena, sizeof(bstd_number));
+    bstd_quotient_into(number, lhs, rhs);
+    return number;
 }
 
-void bstd_subtract_int(bstd_number *lhs, int64_t rhs) {
+void bstd_quotient_into(bstd_number *out, const bstd_number *lhs, const bstd_number *rhs) {
+
+    const bstd_divisor divisor = plain_divisor(rhs);
+
+    if (divisor.value == 0) {
+        return;
+    }
 
-    if (bstd_number_is_integer(lhs)) {
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 magnitude = (__int128) quotient_magnitude(lhs, &divisor, s, false);
 
-        const int64_t current = bstd_number_to_int(lhs);
-        const int64_t difference = current - rhs;
+    store_result(out, bstd_is_negative(lhs) != divisor.negative ? -magnitude : magnitude, s);
+}
+
+void bstd_divide_remainder(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_number *divisor) {
+    const bstd_divisor d = plain_divisor(divisor);
+    divide(quotient, remainder, dividend, &d, false);
+}
+
+void bstd_divisor_init(bstd_divisor *divisor, const bstd_number *number) {
+
+    const uint64_t d = number->value;
+
+    *divisor = plain_divisor(number);
+
+    if (d == 0) {
+        return;
+    }
+
+    const uint8_t floor_log2 = (uint8_t) (63 - __builtin_clzll(d));
+
+    if ((d & (d - 1)) == 0) {
+        // powers of two: magic == 0 marks a plain shift
+        divisor->shift = floor_log2;
+        return;
+    }
 
-        bstd_assign_int64(lhs, difference);
+    // m = floor(2^(64 + floor_log2) / d) fits in 64 bits, because d > 2^floor_log2
+    const unsigned __int128 numerator = (unsigned __int128) 1 << (64 + floor_log2);
+    uint64_t magic = (uint64_t) (numerator / d);
+    const uint64_t rem = (uint64_t) (numerator % d);
 
+    if (d - rem < ((uint64_t) 1 << floor_log2)) {
+        // this power works with a 64-bit magic number
+        divisor->add = false;
     } else {
+        // use the next power, which needs a 65-bit magic number whose top bit is added back in reciprocal_divide
+        const uint64_t twice_rem = rem + rem;
+        magic += magic;
+        if (twice_rem >= d || twice_rem < rem) {
+            magic += 1;
+        }
+        divisor->add = true;
+    }
+
+    divisor->magic = magic + 1;
+    divisor->shift = floor_log2;
+}
+
+void bstd_divide_by(bstd_number *lhs, const bstd_divisor *rhs) {
+    divide(lhs, NULL, lhs, rhs, true);
+}
+
+void bstd_divide_remainder_by(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_divisor *divisor) {
+    divide(quotient, remainder, dividend, divisor, true);
+}
 
-        const double current = bstd_number_to_double(lhs);
-        const double difference = current - rhs;
+void bstd_add_n(bstd_number *lhs, const bstd_number *rhs, size_t n) {
+
+    if (n == 0) {
+        return;
+    }
 
-        bstd_assign_double(lhs, difference);
+    if (!batchable(lhs, n, rhs, n)) {
+        for (size_t i = 0; i < n; ++i) {
+            bstd_add(&lhs[i], &rhs[i]);
+        }
+        return;
     }
+
+    add_batch(lhs, rhs, n, false);
 }
 
-void bstd_add_double(bstd_number *lhs, double rhs) {
+void bstd_subtract_n(bstd_number *lhs, const bstd_number *rhs, size_t n) {
+
+    if (n == 0) {
+        return;
+    }
+
+    if (!batchable(lhs, n, rhs, n)) {
+        for (size_t i = 0; i < n; ++i) {
+            bstd_subtract(&lhs[i], &rhs[i]);
+        }
+        return;
+    }
 
-    if (bstd_number_is_integer(lhs)) {
+    add_batch(lhs, rhs, n, true);
+}
 
-        const int64_t current = bstd_number_to_int(lhs);
-        const int64_t sum = current + rhs;
+void bstd_add_scalar_n(bstd_number *lhs, const bstd_number *rhs, size_t n) {
 
-        bstd_assign_int64(lhs, sum);
+    if (n == 0) {
+        return;
+    }
 
-    } else {
+    if (!batchable(lhs, n, rhs, 1)) {
+        for (size_t i = 0; i < n; ++i) {
+            bstd_add(&lhs[i], rhs);
+        }
+        return;
+    }
 
-        const double current = bstd_number_to_double(lhs);
-        const double sum = current + rhs;
+    const int64_t limit = (int64_t) bstd_pow10_table[lhs->length];
+    const int64_t b = (int64_t) bstd_signed_value(rhs);
+    const bool isSigned = lhs->isSigned;
+    int64_t a[BATCH_BLOCK_SIZE];
 
-        bstd_assign_double(lhs, sum);
+    for (size_t base = 0; base < n; base += BATCH_BLOCK_SIZE) {
+
+        const size_t m = n - base < BATCH_BLOCK_SIZE ? n - base : BATCH_BLOCK_SIZE;
+
+        for (size_t i = 0; i < m; ++i) {
+            a[i] = (int64_t) bstd_signed_value(&lhs[base + i]);
+        }
+
+        bstd_kernel_add_scalar(a, b, m, limit, isSigned);
+
+        for (size_t i = 0; i < m; ++i) {
+            lhs[base + i].value = (uint64_t) (a[i] < 0 ? -a[i] : a[i]);
+            lhs[base + i].positive = !isSigned || a[i] >= 0;
+        }
     }
 }
 
-void bstd_subtract_double(bstd_number *lhs, double rhs) {
+void bstd_add_int(bstd_number *lhs, int64_t rhs) {
+    bstd_store_scaled(lhs, bstd_signed_value(lhs) + bstd_rescale(rhs, 0, lhs->scale));
+}
 
-    if (bstd_number_is_integer(lhs)) {
+void bstd_subtract_int(bstd_number *lhs, int64_t rhs) {
+    bstd_store_scaled(lhs, bstd_signed_value(lhs) - bstd_rescale(rhs, 0, lhs->scale));
+}
 
-        const int64_t current = bstd_number_to_int(lhs);
-        const int64_t difference = current - rhs;
+void bstd_add_double(bstd_number *lhs, double rhs) {
+    add_double(lhs, rhs);
+}
 
-        bstd_assign_int64(lhs, difference);
+void bstd_subtract_double(bstd_number *lhs, double rhs) {
+    add_double(lhs, -rhs);
+}
+
+/**
+ * Drops the sign of the specified accumulator's sum if its target is unsigned, as bstd_store_scaled does after every bstd_add.
+ * @param accumulator The accumulator to normalize.
+ */
+static void accumulator_drop_sign(bstd_accumulator *accumulator) {
+    if (!accumulator->isSigned && accumulator->sum < 0) {
+        accumulator->sum = -accumulator->sum;
+    }
+}
 
+/**
+ * Adds the specified signed value at the specified scale to the specified accumulator.
+ * Values of a larger scale are summed exactly and the sum is truncated towards zero, as bstd_add does.
+ * @param accumulator The accumulator to add to.
+ * @param value The value to add.
+ * @param scale The scale of the specified value.
+ */
+static void accumulate(bstd_accumulator *accumulator, __int128 value, uint64_t scale) {
+
+    if (scale <= accumulator->scale) {
+        accumulator->sum += bstd_rescale(value, scale, accumulator->scale);
     } else {
+        const __int128 exact = bstd_rescale(accumulator->sum, accumulator->scale, scale) + value;
+        accumulator->sum = bstd_rescale(exact, scale, accumulator->scale);
+    }
 
-        const double current = bstd_number_to_double(lhs);
-        const double difference = current - rhs;
+    accumulator_drop_sign(accumulator);
+}
 
-        bstd_assign_double(lhs, difference);
-    }
+void bstd_accumulator_init(bstd_accumulator *accumulator, const bstd_number *target) {
+    accumulator->sum = bstd_signed_value(target);
+    accumulator->scale = target->scale;
+    accumulator->isSigned = target->isSigned;
+}
+
+void bstd_accumulator_add(bstd_accumulator *accumulator, const bstd_number *rhs) {
+    accumulate(accumulator, bstd_signed_value(rhs), rhs->scale);
+}
+
+void bstd_accumulator_subtract(bstd_accumulator *accumulator, const bstd_number *rhs) {
+    accumulate(accumulator, -bstd_signed_value(rhs), rhs->scale);
+}
+
+void bstd_accumulator_add_int64(bstd_accumulator *accumulator, int64_t rhs) {
+    accumulator->sum += bstd_rescale(rhs, 0, accumulator->scale);
+    accumulator_drop_sign(accumulator);
+}
+
+void bstd_accumulator_subtract_int64(bstd_accumulator *accumulator, int64_t rhs) {
+    accumulator->sum -= bstd_rescale(rhs, 0, accumulator->scale);
+    accumulator_drop_sign(accumulator);
+}
+
+void bstd_accumulator_store(const bstd_accumulator *accumulator, bstd_number *target) {
+    bstd_store_scaled(target, bstd_rescale(accumulator->sum, accumulator->scale, target->scale));
 }
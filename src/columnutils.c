@@ -0,0 +1,118 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/columnutils.h"
+#include "../include/arithmetic.h"
+#include "decimal.h"
+#include "allocation.h"
+#include "kernels.h"
+
+/**
+ * Creates a bstd_number view of the specified column value.
+ * @param column The column the value belongs to.
+ * @param value The signed, scaled value.
+ * @return Returns a bstd_number with the column's constraints, holding the specified value.
+ */
+static bstd_number column_number(const bstd_number_column* column, int64_t value) {
+    return (bstd_number) {
+        .value = (uint64_t) (value < 0 ? -value : value),
+        .scale = column->scale,
+        .length = column->length,
+        .isSigned = column->isSigned,
+        .positive = value >= 0
+    };
+}
+
+/**
+ * Applies the specified element-wise operation to every element of the specified columns, one element at a time.
+ * This is the path for columns whose constraints the kernels cannot handle.
+ */
+static void column_apply(bstd_number_column* lhs, const bstd_number_column* rhs, void (*op)(bstd_number*, const bstd_number*)) {
+
+    for (size_t i = 0; i < lhs->size; ++i) {
+        bstd_number a = column_number(lhs, lhs->values[i]);
+        const bstd_number b = column_number(rhs, rhs->values[i]);
+        op(&a, &b);
+        lhs->values[i] = (int64_t) bstd_signed_value(&a);
+    }
+}
+
+bstd_number_column* bstd_create_number_column(size_t size, uint8_t length, uint64_t scale, bool isSigned) {
+    return bstd_create_number_column_arena(NULL, size, length, scale, isSigned);
+}
+
+bstd_number_column* bstd_create_number_column_arena(bstd_arena* arena, size_t size, uint8_t length, uint64_t scale, bool isSigned) {
+
+    // the kernels crop to 10^length in 64 bits, so longer elements cannot be held
+    if (length > BSTD_RESULT_MAX_DIGITS || size > (SIZE_MAX - sizeof(bstd_number_column)) / sizeof(int64_t)) {
+        return NULL;
+    }
+
+    bstd_number_column* column = bstd_allocate(arena, sizeof(bstd_number_column) + sizeof(int64_t) * size);
+
+    if (column == NULL) {
+        return NULL;
+    }
+
+    column->scale = scale;
+    column->size = size;
+    column->length = length;
+    column->isSigned = isSigned;
+    memset(column->values, 0, sizeof(int64_t) * size);
+
+    return column;
+}
+
+void bstd_number_column_get(const bstd_number_column* column, size_t index, bstd_number* out) {
+    *out = column_number(column, column->values[index]);
+}
+
+void bstd_number_column_set(bstd_number_column* column, size_t index, const bstd_number* value) {
+
+    bstd_number element = column_number(column, 0);
+
+    bstd_store_scaled(&element, bstd_rescale(bstd_signed_value(value), value->scale, column->scale));
+    column->values[index] = (int64_t) bstd_signed_value(&element);
+}
+
+void bstd_number_column_for_each(const bstd_number_column* column, void (*fn)(const bstd_number* element, size_t index, void* context), void* context) {
+
+    for (size_t i = 0; i < column->size; ++i) {
+        const bstd_number element = column_number(column, column->values[i]);
+        fn(&element, i, context);
+    }
+}
+
+void bstd_number_column_add(bstd_number_column* lhs, const bstd_number_column* rhs) {
+
+    if (lhs->scale != rhs->scale || rhs->length > lhs->length) {
+        column_apply(lhs, rhs, bstd_add);
+        return;
+    }
+
+    bstd_kernel_add(lhs->values, rhs->values, lhs->size, (int64_t) bstd_pow10_table[lhs->length], lhs->isSigned);
+}
+
+void bstd_number_column_subtract(bstd_number_column* lhs, const bstd_number_column* rhs) {
+
+    if (lhs->scale != rhs->scale || rhs->length > lhs->length) {
+        column_apply(lhs, rhs, bstd_subtract);
+        return;
+    }
+
+    bstd_kernel_subtract(lhs->values, rhs->values, lhs->size, (int64_t) bstd_pow10_table[lhs->length], lhs->isSigned);
+}
+
+void bstd_number_column_add_number(bstd_number_column* lhs, const bstd_number* rhs) {
+
+    if (lhs->scale != rhs->scale || rhs->length > lhs->length) {
+        for (size_t i = 0; i < lhs->size; ++i) {
+            bstd_number a = column_number(lhs, lhs->values[i]);
+            bstd_add(&a, rhs);
+            lhs->values[i] = (int64_t) bstd_signed_value(&a);
+        }
+        return;
+    }
+
+    bstd_kernel_add_scalar(lhs->values, (int64_t) bstd_signed_value(rhs), lhs->size, (int64_t) bstd_pow10_table[lhs->length], lhs->isSigned);
+}
@@ -0,0 +1,104 @@
+#include "../include/compactutils.h"
+#include "../include/arithmetic.h"
+#include "decimal.h"
+
+/**
+ * Stores the specified scaled integer into the specified compact number, following the BabyCobol assignment specifications.
+ * The sign is handled without branches: the magnitude is taken and restored through the value's sign mask.
+ * @param number The compact number to store the value in. Its constraints are not modified.
+ * @param value The value to store, already at the number's scale.
+ */
+static void compact_store(bstd_compact_number* number, __int128 value) {
+
+    const unsigned __int128 limit = bstd_pow10_u128(number->length);
+    const __int128 sign = value >> 127;
+    unsigned __int128 magnitude = (unsigned __int128) ((value ^ sign) - sign);
+
+    if (magnitude >= limit) {
+        magnitude %= limit;
+    }
+
+    // unsigned numbers drop the sign: their sign mask is cleared
+    const int64_t mask = (int64_t) sign & -(int64_t) (number->flags & BSTD_COMPACT_SIGNED);
+
+    number->value = ((int64_t) magnitude ^ mask) - mask;
+}
+
+/**
+ * Keeps the 18 least-significant digits of the specified intermediate result, as a giving result would.
+ * @param value The intermediate result.
+ * @return Returns the cropped result, with the sign of the specified value.
+ */
+static __int128 crop_result(__int128 value) {
+
+    const unsigned __int128 limit = bstd_pow10_table[BSTD_RESULT_MAX_DIGITS];
+    const unsigned __int128 magnitude = bstd_abs_i128(value);
+
+    if (magnitude < limit) {
+        return value;
+    }
+
+    return value < 0 ? -(__int128) (magnitude % limit) : (__int128) (magnitude % limit);
+}
+
+void bstd_compact_from_number(bstd_compact_number* out, const bstd_number* number) {
+
+    out->scale = (uint8_t) number->scale;
+    out->length = number->length > BSTD_COMPACT_NUMBER_MAX_LENGTH ? BSTD_COMPACT_NUMBER_MAX_LENGTH : number->length;
+    out->flags = number->isSigned ? BSTD_COMPACT_SIGNED : 0;
+
+    compact_store(out, bstd_signed_value(number));
+}
+
+void bstd_compact_to_number(bstd_number* out, const bstd_compact_number* compact) {
+
+    const int64_t sign = compact->value >> 63;
+
+    out->value = (uint64_t) ((compact->value ^ sign) - sign);
+    out->scale = compact->scale;
+    out->length = compact->length;
+    out->isSigned = compact->flags & BSTD_COMPACT_SIGNED;
+    out->positive = compact->value >= 0;
+}
+
+void bstd_compact_assign(bstd_compact_number* assignee, const bstd_compact_number* value) {
+    compact_store(assignee, bstd_rescale(value->value, value->scale, assignee->scale));
+}
+
+void bstd_compact_add(bstd_compact_number* lhs, const bstd_compact_number* rhs) {
+
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 a = bstd_rescale(lhs->value, lhs->scale, s);
+    const __int128 b = bstd_rescale(rhs->value, rhs->scale, s);
+
+    compact_store(lhs, bstd_rescale(crop_result(a + b), s, lhs->scale));
+}
+
+void bstd_compact_subtract(bstd_compact_number* lhs, const bstd_compact_number* rhs) {
+
+    const uint64_t s = max(lhs->scale, rhs->scale);
+    const __int128 a = bstd_rescale(lhs->value, lhs->scale, s);
+    const __int128 b = bstd_rescale(rhs->value, rhs->scale, s);
+
+    compact_store(lhs, bstd_rescale(crop_result(a - b), s, lhs->scale));
+}
+
+int bstd_compact_compare(const bstd_compact_number* lhs, const bstd_compact_number* rhs) {
+
+    if (lhs->scale == rhs->scale) {
+        return (lhs->value > rhs->value) - (lhs->value < rhs->value);
+    }
+
+    const bool lhs_negative = lhs->value < 0;
+
+    if (lhs_negative != (rhs->value < 0)) {
+        return lhs_negative ? -1 : 1;
+    }
+
+    const int64_t lhs_sign = lhs->value >> 63;
+    const int64_t rhs_sign = rhs->value >> 63;
+    const int order = bstd_compare_magnitudes((uint64_t) ((lhs->value ^ lhs_sign) - lhs_sign), lhs->scale,
+                                              (uint64_t) ((rhs->value ^ rhs_sign) - rhs_sign), rhs->scale);
+
+    return lhs_negative ? -order : order;
+}
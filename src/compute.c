@@ -0,0 +1,238 @@
+#include <stdlib.h>
+#include "../include/compute.h"
+#include "../include/arithmetic.h"
+#include "decimal.h"
+#include "allocation.h"
+
+/**
+ * A slot of the evaluation stack: an exact, signed, scaled intermediate result.
+ */
+typedef struct slot_t {
+    __int128 value;
+    uint64_t scale;
+} slot;
+
+/**
+ * Counts the instructions needed for the specified expression tree and validates it.
+ * @param expression The root of the tree.
+ * @param depth Set to the number of stack slots needed to evaluate the tree.
+ * @param operands Raised to one more than the largest operand index in the tree.
+ * @return Returns the number of instructions, or zero if the tree is malformed.
+ */
+static size_t measure(const bstd_expression *expression, size_t *depth, size_t *operands) {
+
+    if (expression == NULL) {
+        return 0;
+    }
+
+    size_t lhs_depth;
+    size_t rhs_depth;
+    size_t lhs_size;
+    size_t rhs_size;
+
+    switch (expression->kind) {
+        case BSTD_EXPRESSION_OPERAND:
+            if (expression->operand > UINT32_MAX) {
+                return 0;
+            }
+            if (expression->operand >= *operands) {
+                *operands = expression->operand + 1;
+            }
+            *depth = 1;
+            return 1;
+        case BSTD_EXPRESSION_NEGATE:
+            lhs_size = measure(expression->lhs, depth, operands);
+            return lhs_size == 0 ? 0 : lhs_size + 1;
+        case BSTD_EXPRESSION_ADD:
+        case BSTD_EXPRESSION_SUBTRACT:
+        case BSTD_EXPRESSION_MULTIPLY:
+        case BSTD_EXPRESSION_DIVIDE:
+            lhs_size = measure(expression->lhs, &lhs_depth, operands);
+            rhs_size = measure(expression->rhs, &rhs_depth, operands);
+            if (lhs_size == 0 || rhs_size == 0) {
+                return 0;
+            }
+            // the left-hand result occupies a slot while the right-hand side is evaluated
+            *depth = lhs_depth > rhs_depth + 1 ? lhs_depth : rhs_depth + 1;
+            return lhs_size + rhs_size + 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Emits the postfix instructions for the specified, valid expression tree.
+ * @param expression The root of the tree.
+ * @param code The buffer to emit the instructions to.
+ * @return Returns the position after the last emitted instruction.
+ */
+static bstd_instruction* emit(const bstd_expression *expression, bstd_instruction *code) {
+
+    if (expression->kind != BSTD_EXPRESSION_OPERAND) {
+        code = emit(expression->lhs, code);
+        if (expression->kind != BSTD_EXPRESSION_NEGATE) {
+            code = emit(expression->rhs, code);
+        }
+    }
+
+    code->opcode = (uint8_t) expression->kind;
+    code->operand = expression->kind == BSTD_EXPRESSION_OPERAND ? (uint32_t) expression->operand : 0;
+
+    return code + 1;
+}
+
+bstd_program* bstd_compute_compile(const bstd_expression *expression) {
+    return bstd_compute_compile_arena(NULL, expression);
+}
+
+bstd_program* bstd_compute_compile_arena(bstd_arena *arena, const bstd_expression *expression) {
+
+    size_t depth = 0;
+    size_t operands = 0;
+    const size_t size = measure(expression, &depth, &operands);
+
+    if (size == 0 || depth > BSTD_COMPUTE_MAX_DEPTH) {
+        return NULL;
+    }
+
+    bstd_program *program = bstd_allocate(arena, sizeof(bstd_program) + sizeof(bstd_instruction) * size);
+
+    program->size = size;
+    program->operands = operands;
+    emit(expression, program->code);
+
+    return program;
+}
+
+/**
+ * Determines whether the specified value fits a signed 64-bit integer, so that 64-bit fast paths apply.
+ */
+static inline bool fits_int64(__int128 value) {
+    return value == (int64_t) value;
+}
+
+/**
+ * Raises the scale of the specified slot, exactly.
+ * @param s The slot to rescale.
+ * @param scale The new scale; not less than the slot's scale.
+ * @return Returns false iff the rescaled value does not fit 128 bits.
+ */
+static bool align(slot *s, uint64_t scale) {
+
+    const uint64_t exp = scale - s->scale;
+
+    s->scale = scale;
+
+    if (exp == 0) {
+        return true;
+    }
+
+    if (exp <= BSTD_POW10_MAX_EXP && fits_int64(s->value)) {
+        // |value| < 2^63 and 10^exp < 2^64, so the product cannot overflow
+        s->value *= bstd_pow10_table[exp];
+        return true;
+    }
+
+    return !__builtin_mul_overflow(s->value, (__int128) bstd_pow10_u128(exp), &s->value);
+}
+
+/**
+ * Drops the digits of the specified slot beyond the maximum intermediate scale, truncating towards zero.
+ * @param s The slot to limit.
+ */
+static void limit_scale(slot *s) {
+
+    if (s->scale > BSTD_COMPUTE_MAX_SCALE) {
+        s->value = bstd_rescale(s->value, s->scale, BSTD_COMPUTE_MAX_SCALE);
+        s->scale = BSTD_COMPUTE_MAX_SCALE;
+    }
+}
+
+bool bstd_compute(const bstd_program *program, const bstd_number *const *operands, bstd_number *target) {
+
+    slot stack[BSTD_COMPUTE_MAX_DEPTH];
+    slot *top = stack - 1;
+
+    for (size_t i = 0; i < program->size; ++i) {
+
+        const bstd_instruction instruction = program->code[i];
+
+        if (instruction.opcode == BSTD_EXPRESSION_OPERAND) {
+            const bstd_number *operand = operands[instruction.operand];
+            ++top;
+            top->value = bstd_signed_value(operand);
+            top->scale = operand->scale;
+            continue;
+        }
+
+        if (instruction.opcode == BSTD_EXPRESSION_NEGATE) {
+            if (__builtin_sub_overflow((__int128) 0, top->value, &top->value)) {
+                return false;
+            }
+            continue;
+        }
+
+        slot *lhs = top - 1;
+        slot rhs = *top;
+        top = lhs;
+
+        switch (instruction.opcode) {
+            case BSTD_EXPRESSION_ADD:
+            case BSTD_EXPRESSION_SUBTRACT: {
+                const uint64_t scale = max(lhs->scale, rhs.scale);
+                if (!align(lhs, scale) || !align(&rhs, scale)) {
+                    return false;
+                }
+                const bool overflow = instruction.opcode == BSTD_EXPRESSION_ADD
+                                      ? __builtin_add_overflow(lhs->value, rhs.value, &lhs->value)
+                                      : __builtin_sub_overflow(lhs->value, rhs.value, &lhs->value);
+                if (overflow) {
+                    return false;
+                }
+                break;
+            }
+            case BSTD_EXPRESSION_MULTIPLY:
+                if (fits_int64(lhs->value) && fits_int64(rhs.value)) {
+                    lhs->value = (__int128) (int64_t) lhs->value * (int64_t) rhs.value;
+                } else if (__builtin_mul_overflow(lhs->value, rhs.value, &lhs->value)) {
+                    return false;
+                }
+                lhs->scale += rhs.scale;
+                limit_scale(lhs);
+                break;
+            case BSTD_EXPRESSION_DIVIDE: {
+                if (rhs.value == 0) {
+                    return false;
+                }
+                // (a / 10^sa) / (b / 10^sb) at scale q is a * 10^(q + sb - sa) / b
+                const uint64_t scale = max(max(lhs->scale, rhs.scale), target->scale);
+                if (!align(lhs, scale + rhs.scale)) {
+                    return false;
+                }
+                if (rhs.value == -1) {
+                    // the one quotient that can overflow: the most negative value divided by -1
+                    if (__builtin_sub_overflow((__int128) 0, lhs->value, &lhs->value)) {
+                        return false;
+                    }
+                } else if (fits_int64(lhs->value) && fits_int64(rhs.value)) {
+                    lhs->value = (int64_t) lhs->value / (int64_t) rhs.value;
+                } else {
+                    lhs->value /= rhs.value;
+                }
+                lhs->scale = scale;
+                limit_scale(lhs);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    // only the final result is truncated and cropped
+    if (top->scale < target->scale && !align(top, target->scale)) {
+        return false;
+    }
+
+    bstd_store_scaled(target, bstd_rescale(top->value, top->scale, target->scale));
+    return true;
+}
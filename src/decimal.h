@@ -0,0 +1,301 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "../include/number.h"
+
+/*
+ * Internal integer-only helpers for fixed-point arithmetic on bstd_number.
+ * Nothing in here calls into libm or converts through double.
+ */
+
+/**
+ * The largest power of ten that fits in an unsigned 64-bit integer.
+ */
+#define BSTD_POW10_MAX_EXP 19
+
+/**
+ * The number of digits a computed (giving) result may hold before it is truncated.
+ */
+#define BSTD_RESULT_MAX_DIGITS 18
+
+/**
+ * Powers of ten: bstd_pow10_table[i] == 10^i.
+ */
+static const uint64_t bstd_pow10_table[BSTD_POW10_MAX_EXP + 1] = {
+        1ULL,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL,
+        10000000000ULL,
+        100000000000ULL,
+        1000000000000ULL,
+        10000000000000ULL,
+        100000000000000ULL,
+        1000000000000000ULL,
+        10000000000000000ULL,
+        100000000000000000ULL,
+        1000000000000000000ULL,
+        10000000000000000000ULL,
+};
+
+/**
+ * Gets ten to the power of the specified exponent as a 128-bit integer.
+ * @param exp The exponent. Exponents larger than 38 overflow.
+ * @return Returns 10^exp.
+ */
+static inline unsigned __int128 bstd_pow10_u128(uint64_t exp) {
+
+    if (exp <= BSTD_POW10_MAX_EXP) {
+        return bstd_pow10_table[exp];
+    }
+
+    return (unsigned __int128) bstd_pow10_table[BSTD_POW10_MAX_EXP] * bstd_pow10_table[exp - BSTD_POW10_MAX_EXP];
+}
+
+/**
+ * Counts the decimal digits of the specified value, using the position of its leading one-bit to estimate the count.
+ * @param value The value to count the digits of.
+ * @return Returns the number of decimal digits in value; zero has one digit.
+ */
+static inline uint8_t bstd_digit_count(uint64_t value) {
+
+    // floor(log10(2^bits)) approximated as bits * 1233 / 4096, corrected by a single table compare
+    const uint32_t bits = 64 - __builtin_clzll(value | 1);
+    const uint32_t estimate = (bits * 1233) >> 12;
+
+    return (uint8_t) (estimate + (value >= bstd_pow10_table[estimate]) + (value == 0));
+}
+
+/**
+ * Counts the decimal digits of the specified 128-bit value.
+ * @param value The value to count the digits of.
+ * @return Returns the number of decimal digits in value; zero has one digit.
+ */
+static inline uint8_t bstd_digit_count_u128(unsigned __int128 value) {
+
+    uint8_t digits = 0;
+
+    while (value > UINT64_MAX) {
+        value /= bstd_pow10_table[BSTD_POW10_MAX_EXP];
+        digits += BSTD_POW10_MAX_EXP;
+    }
+
+    return digits + bstd_digit_count((uint64_t) value);
+}
+
+/**
+ * Gets the absolute value of the specified 128-bit integer.
+ */
+static inline unsigned __int128 bstd_abs_i128(__int128 value) {
+    return value < 0 ? -(unsigned __int128) value : (unsigned __int128) value;
+}
+
+/**
+ * Gets the signed, scaled integer held by the specified number.
+ * Unsigned numbers are always non-negative, regardless of their positive flag.
+ * @param number The number to get the signed value of.
+ * @return Returns the signed value of the number at its own scale.
+ */
+static inline __int128 bstd_signed_value(const bstd_number *number) {
+    return !number->positive && number->isSigned ? -(__int128) number->value : (__int128) number->value;
+}
+
+/**
+ * Determines whether the specified number holds a negative value.
+ * @param number The number to evaluate.
+ * @return Returns true iff the number is signed and not positive.
+ */
+static inline bool bstd_is_negative(const bstd_number *number) {
+    return number->isSigned && !number->positive;
+}
+
+/**
+ * Divides the specified unsigned 128-bit value by ten to the power of the specified exponent, truncating the result.
+ * @param value The value to divide.
+ * @param exp The exponent of the power of ten to divide by.
+ * @return Returns value / 10^exp.
+ */
+static inline unsigned __int128 bstd_div_pow10_u128(unsigned __int128 value, uint64_t exp) {
+
+    if (exp <= BSTD_POW10_MAX_EXP && value <= UINT64_MAX) {
+        // 64-bit fast path; avoids a call into the 128-bit division routine
+        return (uint64_t) value / bstd_pow10_table[exp];
+    }
+
+    return value / bstd_pow10_u128(exp);
+}
+
+/**
+ * Converts the specified scaled integer from one scale to another.
+ * Digits beyond the target scale are truncated towards zero, as BabyCobol assignment requires.
+ * @param value The scaled integer to convert.
+ * @param from The scale of the specified value.
+ * @param to The scale to convert the value to.
+ * @return Returns the value at the target scale.
+ */
+static inline __int128 bstd_rescale(__int128 value, uint64_t from, uint64_t to) {
+
+    if (to >= from) {
+        return value * (__int128) bstd_pow10_u128(to - from);
+    }
+
+    const unsigned __int128 magnitude = bstd_div_pow10_u128(bstd_abs_i128(value), from - to);
+
+    return value < 0 ? -(__int128) magnitude : (__int128) magnitude;
+}
+
+/**
+ * Compares the specified scaled magnitudes exactly, regardless of their scales.
+ * The side of the smaller scale is scaled up to the other scale without any division: for 64-bit magnitudes and scales
+ * at most 19 apart this is a single 64 x 64 -> 128-bit multiply. A scaled side that overflows 128 bits is the larger one.
+ * @param a The left-hand magnitude.
+ * @param a_scale The scale of the left-hand magnitude.
+ * @param b The right-hand magnitude.
+ * @param b_scale The scale of the right-hand magnitude.
+ * @return Returns -1 if a < b, 0 if a == b and 1 if a > b.
+ */
+static inline int bstd_compare_magnitudes(unsigned __int128 a, uint64_t a_scale, unsigned __int128 b, uint64_t b_scale) {
+
+    int order = 1;
+
+    if (a_scale > b_scale) {
+        // scale up b instead, and invert the order
+        const unsigned __int128 value = a;
+        const uint64_t scale = a_scale;
+        a = b;
+        a_scale = b_scale;
+        b = value;
+        b_scale = scale;
+        order = -1;
+    }
+
+    const uint64_t exp = b_scale - a_scale;
+    unsigned __int128 scaled;
+
+    if (a <= UINT64_MAX && exp <= BSTD_POW10_MAX_EXP) {
+        scaled = (unsigned __int128) (uint64_t) a * bstd_pow10_table[exp];
+    } else if (a == 0) {
+        scaled = 0;
+    } else if (exp > 2 * BSTD_POW10_MAX_EXP || __builtin_mul_overflow(a, bstd_pow10_u128(exp), &scaled)) {
+        // a nonzero magnitude scaled past 10^38 exceeds every 128-bit magnitude
+        return order;
+    }
+
+    return scaled > b ? order : scaled < b ? -order : 0;
+}
+
+/**
+ * Stores the specified scaled integer into the specified number, following the BabyCobol assignment specifications:
+ * high-order digits that do not fit the number's length are cropped, unsigned numbers drop the sign, and zero is never negative.
+ * @param number The number to store the value in. Its constraints are not modified.
+ * @param value The value to store, already at the number's scale.
+ */
+static inline void bstd_store_scaled(bstd_number *number, __int128 value) {
+
+    unsigned __int128 magnitude = bstd_abs_i128(value);
+
+    if (number->length < 2 * BSTD_POW10_MAX_EXP) {
+        const unsigned __int128 limit = bstd_pow10_u128(number->length);
+        if (magnitude >= limit) {
+            magnitude %= limit;
+        }
+    }
+
+    number->positive = !number->isSigned || value >= 0 || magnitude == 0;
+    number->value = (uint64_t) magnitude;
+}
+
+/**
+ * Stores the specified scaled integer into the specified number, unless its integer digits do not fit the number's length.
+ * This is the ON SIZE ERROR counterpart of bstd_store_scaled: instead of cropping, the number is left unchanged.
+ * @param number The number to store the value in. Its constraints are not modified.
+ * @param value The value to store, already at the number's scale.
+ * @return Returns false iff the value does not fit the number's length.
+ */
+static inline bool bstd_store_scaled_checked(bstd_number *number, __int128 value) {
+
+    if (number->length < 2 * BSTD_POW10_MAX_EXP && bstd_abs_i128(value) >= bstd_pow10_u128(number->length)) {
+        return false;
+    }
+
+    bstd_store_scaled(number, value);
+    return true;
+}
+
+/**
+ * Every two-digit decimal number, in order: bstd_digit_pairs[2 * n] and bstd_digit_pairs[2 * n + 1] are the digits of n.
+ */
+static const char bstd_digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+/**
+ * Determines whether the specified eight characters, loaded little-endian, are all ASCII digits.
+ */
+static inline bool bstd_is_eight_digits(uint64_t chars) {
+    return ((chars & 0xF0F0F0F0F0F0F0F0) | (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * Converts the specified eight ASCII digits, loaded little-endian, to their value: three multiply steps combine
+ * adjacent digits into pairs, pairs into quadruples and quadruples into the final eight-digit value.
+ */
+static inline uint32_t bstd_parse_eight_digits(uint64_t chars) {
+    chars = ((chars & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    chars = ((chars & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    return (uint32_t) (((chars & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+}
+
+#endif
+
+/**
+ * Converts the specified run of characters to its value, eight digits per step where possible.
+ * @param str The characters to convert.
+ * @param n The number of characters to convert. At most 19.
+ * @param out The value to store the conversion in.
+ * @return Returns true iff every character is a digit.
+ */
+static inline bool bstd_parse_digits(const char* str, size_t n, uint64_t* out) {
+
+    uint64_t value = 0;
+    size_t i = 0;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (; i + 8 <= n; i += 8) {
+        uint64_t chars;
+        memcpy(&chars, str + i, sizeof(chars));
+        if (!bstd_is_eight_digits(chars)) {
+            return false;
+        }
+        value = value * 100000000 + bstd_parse_eight_digits(chars);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const unsigned char digit = (unsigned char) (str[i] - '0');
+        if (digit > 9) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+
+    *out = value;
+    return true;
+}
@@ -0,0 +1,298 @@
+#include "../include/encoding.h"
+#include "decimal.h"
+
+#if !defined(BSTD_NO_SIMD) && defined(__SSE2__)
+#define BSTD_ENCODING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * Every two-digit decimal number as a packed-decimal byte: packed_pairs[n] holds the digits of n in its high and low nibble.
+ */
+#define PACKED_PAIR_ROW(tens) \
+        (tens) << 4 | 0, (tens) << 4 | 1, (tens) << 4 | 2, (tens) << 4 | 3, (tens) << 4 | 4, \
+        (tens) << 4 | 5, (tens) << 4 | 6, (tens) << 4 | 7, (tens) << 4 | 8, (tens) << 4 | 9
+
+static const unsigned char packed_pairs[100] = {
+        PACKED_PAIR_ROW(0), PACKED_PAIR_ROW(1), PACKED_PAIR_ROW(2), PACKED_PAIR_ROW(3), PACKED_PAIR_ROW(4),
+        PACKED_PAIR_ROW(5), PACKED_PAIR_ROW(6), PACKED_PAIR_ROW(7), PACKED_PAIR_ROW(8), PACKED_PAIR_ROW(9),
+};
+
+#ifdef BSTD_ENCODING_SSE2
+
+/**
+ * Decodes eight full packed-decimal bytes (sixteen digits) at once: the nibbles are split, combined into base-100 bytes,
+ * widened and folded pairwise with multiply-add into two eight-digit halves.
+ * @param bytes The packed bytes to decode.
+ * @param out The value to store the sixteen-digit result in.
+ * @return Returns true iff every nibble is a decimal digit.
+ */
+static bool unpack_sixteen_digits(const unsigned char* bytes, uint64_t* out) {
+
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i packed = _mm_loadl_epi64((const __m128i*) bytes);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), nibble_mask);
+    const __m128i low = _mm_and_si128(packed, nibble_mask);
+
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i invalid = _mm_or_si128(_mm_cmpgt_epi8(high, nine), _mm_cmpgt_epi8(low, nine));
+    if ((_mm_movemask_epi8(invalid) & 0xFF) != 0) {
+        return false;
+    }
+
+    // high * 10 + low, computed as high * 8 + high * 2 + low within bytes
+    const __m128i high2 = _mm_add_epi8(high, high);
+    const __m128i high8 = _mm_add_epi8(_mm_add_epi8(high2, high2), _mm_add_epi8(high2, high2));
+    const __m128i pairs = _mm_add_epi8(_mm_add_epi8(high8, high2), low);
+
+    // (pair[0] * 100 + pair[1]), ... as four 32-bit lanes of four digits each
+    const __m128i words = _mm_unpacklo_epi8(pairs, _mm_setzero_si128());
+    const __m128i quads = _mm_madd_epi16(words, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+
+    // (quad[0] * 10000 + quad[1]), ... as two 32-bit lanes of eight digits each
+    const __m128i quad_words = _mm_packs_epi32(quads, _mm_setzero_si128());
+    const __m128i octs = _mm_madd_epi16(quad_words, _mm_setr_epi16(10000, 1, 10000, 1, 0, 0, 0, 0));
+
+    *out = (uint64_t) (uint32_t) _mm_cvtsi128_si32(octs) * 100000000
+           + (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(octs, 4));
+    return true;
+}
+
+#endif
+
+bool bstd_number_from_packed(bstd_number* number, const unsigned char* bytes, size_t size) {
+
+    if (size == 0 || size > BSTD_PACKED_MAX_SIZE) {
+        return false;
+    }
+
+    const unsigned char sign = bytes[size - 1] & 0x0F;
+
+    if (sign < 0x0A) {
+        return false;
+    }
+
+    uint64_t value = 0;
+    size_t i = 0;
+
+#ifdef BSTD_ENCODING_SSE2
+    if (size - 1 >= 8) {
+        if (!unpack_sixteen_digits(bytes, &value)) {
+            return false;
+        }
+        i = 8;
+    }
+#endif
+
+    for (; i < size - 1; ++i) {
+        const unsigned char high = bytes[i] >> 4;
+        const unsigned char low = bytes[i] & 0x0F;
+        if (high > 9 || low > 9) {
+            return false;
+        }
+        value = value * 100 + high * 10 + low;
+    }
+
+    const unsigned char last = bytes[size - 1] >> 4;
+
+    if (last > 9) {
+        return false;
+    }
+
+    const __int128 magnitude = (__int128) (value * 10 + last);
+    const bool negative = sign == 0x0B || sign == 0x0D;
+
+    bstd_store_scaled(number, negative ? -magnitude : magnitude);
+    return true;
+}
+
+void bstd_number_to_packed(const bstd_number* number, unsigned char* bytes, size_t size) {
+
+    if (size == 0 || size > BSTD_PACKED_MAX_SIZE) {
+        return;
+    }
+
+    // digits that do not fit the field are dropped from the front
+    uint64_t value = number->value;
+    unsigned char sign;
+
+    if (!number->isSigned) {
+        sign = BSTD_PACKED_SIGN_UNSIGNED;
+    } else {
+        sign = bstd_is_negative(number) && number->value != 0 ? BSTD_PACKED_SIGN_NEGATIVE : BSTD_PACKED_SIGN_POSITIVE;
+    }
+
+    bytes[size - 1] = (unsigned char) ((value % 10) << 4 | sign);
+    value /= 10;
+
+    for (size_t i = size - 1; i > 0; --i) {
+        bytes[i - 1] = packed_pairs[value % 100];
+        value /= 100;
+    }
+}
+
+size_t bstd_number_from_packed_n(bstd_number* numbers, const unsigned char* records, size_t record_size, size_t offset, size_t size, size_t n) {
+
+    size_t decoded = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        decoded += bstd_number_from_packed(&numbers[i], records + i * record_size + offset, size);
+    }
+
+    return decoded;
+}
+
+void bstd_number_to_packed_n(const bstd_number* numbers, unsigned char* records, size_t record_size, size_t offset, size_t size, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        bstd_number_to_packed(&numbers[i], records + i * record_size + offset, size);
+    }
+}
+
+/**
+ * Overpunched digits, indexed by digit: positive_overpunch[d] is +d and negative_overpunch[d] is -d.
+ */
+static const char positive_overpunch[10] = { '{', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I' };
+static const char negative_overpunch[10] = { '}', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R' };
+
+/**
+ * Decodes the specified character holding an embedded sign.
+ * @param c The character to decode: an overpunched digit or a plain, positive digit.
+ * @param negative Set to true iff the character holds a negative sign.
+ * @return Returns the digit held by the character, or -1 if the character is not valid.
+ */
+static int decode_overpunch(char c, bool* negative) {
+
+    *negative = false;
+
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'I') {
+        return c - 'A' + 1;
+    }
+    if (c == '{') {
+        return 0;
+    }
+
+    *negative = true;
+
+    if (c >= 'J' && c <= 'R') {
+        return c - 'J' + 1;
+    }
+    if (c == '}') {
+        return 0;
+    }
+
+    return -1;
+}
+
+bool bstd_number_from_zoned(bstd_number* number, const char* str, size_t size, bstd_zoned_sign sign) {
+
+    const bool separate = sign == BSTD_ZONED_TRAILING_SEPARATE || sign == BSTD_ZONED_LEADING_SEPARATE;
+    const bool leading = sign == BSTD_ZONED_LEADING || sign == BSTD_ZONED_LEADING_SEPARATE;
+    const size_t digits = separate ? size - 1 : size;
+
+    if (size == 0 || digits == 0 || digits > BSTD_ZONED_MAX_DIGITS) {
+        return false;
+    }
+
+    const char* run = separate && leading ? str + 1 : str;
+    bool negative = false;
+    uint64_t value;
+
+    if (sign == BSTD_ZONED_UNSIGNED || separate) {
+
+        if (separate) {
+            const char c = leading ? str[0] : str[size - 1];
+            if (c != '+' && c != '-') {
+                return false;
+            }
+            negative = c == '-';
+        }
+
+        if (!bstd_parse_digits(run, digits, &value)) {
+            return false;
+        }
+
+    } else {
+
+        // replace the overpunched character by its digit, so the whole run converts at once
+        char buffer[BSTD_ZONED_MAX_DIGITS];
+        const size_t position = leading ? 0 : digits - 1;
+        const int digit = decode_overpunch(run[position], &negative);
+
+        if (digit < 0) {
+            return false;
+        }
+
+        memcpy(buffer, run, digits);
+        buffer[position] = (char) ('0' + digit);
+
+        if (!bstd_parse_digits(buffer, digits, &value)) {
+            return false;
+        }
+    }
+
+    bstd_store_scaled(number, negative ? -(__int128) value : (__int128) value);
+    return true;
+}
+
+void bstd_number_to_zoned(const bstd_number* number, char* str, size_t size, bstd_zoned_sign sign) {
+
+    const bool separate = sign == BSTD_ZONED_TRAILING_SEPARATE || sign == BSTD_ZONED_LEADING_SEPARATE;
+    const bool leading = sign == BSTD_ZONED_LEADING || sign == BSTD_ZONED_LEADING_SEPARATE;
+    const size_t digits = separate ? size - 1 : size;
+
+    if (size == 0 || digits == 0 || digits > BSTD_ZONED_MAX_DIGITS) {
+        return;
+    }
+
+    char* run = separate && leading ? str + 1 : str;
+    uint64_t value = number->value;
+
+    // digits are written right to left, two per step; digits that do not fit the field are dropped from the front
+    char* p = run + digits;
+
+    while (p - run >= 2) {
+        const uint64_t pair = value % 100;
+        value /= 100;
+        p -= 2;
+        p[0] = bstd_digit_pairs[2 * pair];
+        p[1] = bstd_digit_pairs[2 * pair + 1];
+    }
+
+    if (p > run) {
+        *--p = (char) ('0' + value % 10);
+    }
+
+    if (sign == BSTD_ZONED_UNSIGNED) {
+        return;
+    }
+
+    const bool negative = bstd_is_negative(number) && number->value != 0;
+
+    if (separate) {
+        str[leading ? 0 : size - 1] = negative ? '-' : '+';
+    } else {
+        const size_t position = leading ? 0 : digits - 1;
+        const int digit = run[position] - '0';
+        run[position] = negative ? negative_overpunch[digit] : positive_overpunch[digit];
+    }
+}
+
+size_t bstd_number_from_zoned_n(bstd_number* numbers, const char* records, size_t record_size, size_t offset, size_t size, bstd_zoned_sign sign, size_t n) {
+
+    size_t decoded = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        decoded += bstd_number_from_zoned(&numbers[i], records + i * record_size + offset, size, sign);
+    }
+
+    return decoded;
+}
+
+void bstd_number_to_zoned_n(const bstd_number* numbers, char* records, size_t record_size, size_t offset, size_t size, bstd_zoned_sign sign, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        bstd_number_to_zoned(&numbers[i], records + i * record_size + offset, size, sign);
+    }
+}
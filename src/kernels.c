@@ -0,0 +1,401 @@
+#include "kernels.h"
+#include "masks.h"
+
+#if !defined(BSTD_NO_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BSTD_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Crops the specified sum or difference of two values that each fit the specified limit.
+ * @param value The value to crop; |value| < 2 * limit.
+ * @param limit Ten to the power of the length to crop to.
+ * @param isSigned If false, the sign of the value is dropped.
+ * @return Returns the cropped value.
+ */
+static inline int64_t crop(int64_t value, int64_t limit, bool isSigned) {
+
+    if (value >= limit) {
+        value -= limit;
+    } else if (value <= -limit) {
+        value += limit;
+    }
+
+    return !isSigned && value < 0 ? -value : value;
+}
+
+static void add_scalar(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned, bool subtract) {
+    for (size_t i = 0; i < n; ++i) {
+        lhs[i] = crop(subtract ? lhs[i] - rhs[i] : lhs[i] + rhs[i], limit, isSigned);
+    }
+}
+
+static void add_broadcast_scalar(int64_t *lhs, int64_t rhs, size_t n, int64_t limit, bool isSigned) {
+    for (size_t i = 0; i < n; ++i) {
+        lhs[i] = crop(lhs[i] + rhs, limit, isSigned);
+    }
+}
+
+static void mask_digits_scalar(char *dst, const unsigned char *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = (char) BSTD_MASK_9_OF(src[i]);
+    }
+}
+
+static void unmask_digits_scalar(unsigned char *dst, const char *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = BSTD_UNMASK_9_OF((unsigned char) src[i]);
+    }
+}
+
+static void mask_alpha_scalar(unsigned char *dst, const unsigned char *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = BSTD_MASK_A_OF(src[i]);
+    }
+}
+
+#ifdef BSTD_KERNELS_X86
+
+__attribute__((target("sse4.2")))
+static inline __m128i crop_sse42(__m128i value, __m128i limit, __m128i max, __m128i min, bool isSigned) {
+
+    // value > limit - 1 <=> value >= limit, so the limit is subtracted; likewise added below -(limit - 1)
+    value = _mm_sub_epi64(value, _mm_and_si128(_mm_cmpgt_epi64(value, max), limit));
+    value = _mm_add_epi64(value, _mm_and_si128(_mm_cmpgt_epi64(min, value), limit));
+
+    if (!isSigned) {
+        const __m128i negative = _mm_cmpgt_epi64(_mm_setzero_si128(), value);
+        value = _mm_sub_epi64(_mm_xor_si128(value, negative), negative);
+    }
+
+    return value;
+}
+
+__attribute__((target("sse4.2")))
+static void add_sse42(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned, bool subtract) {
+
+    const __m128i l = _mm_set1_epi64x(limit);
+    const __m128i max = _mm_set1_epi64x(limit - 1);
+    const __m128i min = _mm_set1_epi64x(-(limit - 1));
+    size_t i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *) (rhs + i));
+        const __m128i s = subtract ? _mm_sub_epi64(a, b) : _mm_add_epi64(a, b);
+        _mm_storeu_si128((__m128i *) (lhs + i), crop_sse42(s, l, max, min, isSigned));
+    }
+
+    add_scalar(lhs + i, rhs + i, n - i, limit, isSigned, subtract);
+}
+
+__attribute__((target("sse4.2")))
+static void add_broadcast_sse42(int64_t *lhs, int64_t rhs, size_t n, int64_t limit, bool isSigned) {
+
+    const __m128i b = _mm_set1_epi64x(rhs);
+    const __m128i l = _mm_set1_epi64x(limit);
+    const __m128i max = _mm_set1_epi64x(limit - 1);
+    const __m128i min = _mm_set1_epi64x(-(limit - 1));
+    size_t i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (lhs + i));
+        _mm_storeu_si128((__m128i *) (lhs + i), crop_sse42(_mm_add_epi64(a, b), l, max, min, isSigned));
+    }
+
+    add_broadcast_scalar(lhs + i, rhs, n - i, limit, isSigned);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i crop_avx2(__m256i value, __m256i limit, __m256i max, __m256i min, bool isSigned) {
+
+    value = _mm256_sub_epi64(value, _mm256_and_si256(_mm256_cmpgt_epi64(value, max), limit));
+    value = _mm256_add_epi64(value, _mm256_and_si256(_mm256_cmpgt_epi64(min, value), limit));
+
+    if (!isSigned) {
+        const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), value);
+        value = _mm256_sub_epi64(_mm256_xor_si256(value, negative), negative);
+    }
+
+    return value;
+}
+
+__attribute__((target("avx2")))
+static void add_avx2(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned, bool subtract) {
+
+    const __m256i l = _mm256_set1_epi64x(limit);
+    const __m256i max = _mm256_set1_epi64x(limit - 1);
+    const __m256i min = _mm256_set1_epi64x(-(limit - 1));
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *) (rhs + i));
+        const __m256i s = subtract ? _mm256_sub_epi64(a, b) : _mm256_add_epi64(a, b);
+        _mm256_storeu_si256((__m256i *) (lhs + i), crop_avx2(s, l, max, min, isSigned));
+    }
+
+    add_scalar(lhs + i, rhs + i, n - i, limit, isSigned, subtract);
+}
+
+__attribute__((target("avx2")))
+static void add_broadcast_avx2(int64_t *lhs, int64_t rhs, size_t n, int64_t limit, bool isSigned) {
+
+    const __m256i b = _mm256_set1_epi64x(rhs);
+    const __m256i l = _mm256_set1_epi64x(limit);
+    const __m256i max = _mm256_set1_epi64x(limit - 1);
+    const __m256i min = _mm256_set1_epi64x(-(limit - 1));
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *) (lhs + i));
+        _mm256_storeu_si256((__m256i *) (lhs + i), crop_avx2(_mm256_add_epi64(a, b), l, max, min, isSigned));
+    }
+
+    add_broadcast_scalar(lhs + i, rhs, n - i, limit, isSigned);
+}
+
+/*
+ * The picture kernels compare bytes as unsigned values: x <= max iff min(x, max) == x.
+ * Digit bytes above 9 are rare, so a block holding one falls back to the scalar conversion.
+ */
+
+__attribute__((target("sse4.2")))
+static void mask_digits_sse42(char *dst, const unsigned char *src, size_t n) {
+
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) (src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(bytes, nine), bytes)) != 0xFFFF) {
+            mask_digits_scalar(dst + i, src + i, 16);
+            continue;
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_add_epi8(bytes, zero));
+    }
+
+    mask_digits_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+static void unmask_digits_sse42(unsigned char *dst, const char *src, size_t n) {
+
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m128i digits = _mm_sub_epi8(_mm_loadu_si128((const __m128i *) (src + i)), zero);
+        const __m128i valid = _mm_cmpeq_epi8(_mm_min_epu8(digits, nine), digits);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_and_si128(digits, valid));
+    }
+
+    unmask_digits_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+static void mask_alpha_sse42(unsigned char *dst, const unsigned char *src, size_t n) {
+
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i a = _mm_set1_epi8('a');
+    const __m128i letters = _mm_set1_epi8('z' - 'a');
+    const __m128i space = _mm_set1_epi8(BSTD_SPACE);
+    size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i offset = _mm_sub_epi8(_mm_or_si128(bytes, lower), a);
+        const __m128i letter = _mm_cmpeq_epi8(_mm_min_epu8(offset, letters), offset);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_blendv_epi8(space, bytes, letter));
+    }
+
+    mask_alpha_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void mask_digits_avx2(char *dst, const unsigned char *src, size_t n) {
+
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i zero = _mm256_set1_epi8('0');
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i *) (src + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(bytes, nine), bytes)) != -1) {
+            mask_digits_scalar(dst + i, src + i, 32);
+            continue;
+        }
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_add_epi8(bytes, zero));
+    }
+
+    // the 16-byte remainder runs legacy SSE code, which stalls while the upper halves of the registers are dirty
+    _mm256_zeroupper();
+    mask_digits_sse42(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void unmask_digits_avx2(unsigned char *dst, const char *src, size_t n) {
+
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i zero = _mm256_set1_epi8('0');
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        const __m256i digits = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i *) (src + i)), zero);
+        const __m256i valid = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, nine), digits);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_and_si256(digits, valid));
+    }
+
+    // the 16-byte remainder runs legacy SSE code, which stalls while the upper halves of the registers are dirty
+    _mm256_zeroupper();
+    unmask_digits_sse42(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void mask_alpha_avx2(unsigned char *dst, const unsigned char *src, size_t n) {
+
+    const __m256i lower = _mm256_set1_epi8(0x20);
+    const __m256i a = _mm256_set1_epi8('a');
+    const __m256i letters = _mm256_set1_epi8('z' - 'a');
+    const __m256i space = _mm256_set1_epi8(BSTD_SPACE);
+    size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i *) (src + i));
+        const __m256i offset = _mm256_sub_epi8(_mm256_or_si256(bytes, lower), a);
+        const __m256i letter = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, letters), offset);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_blendv_epi8(space, bytes, letter));
+    }
+
+    // the 16-byte remainder runs legacy SSE code, which stalls while the upper halves of the registers are dirty
+    _mm256_zeroupper();
+    mask_alpha_sse42(dst + i, src + i, n - i);
+}
+
+#endif // BSTD_KERNELS_X86
+
+/**
+ * The instruction set extensions the kernels can use on this machine, from least to most capable.
+ */
+typedef enum {
+    KERNEL_LEVEL_SCALAR,
+    KERNEL_LEVEL_SSE42,
+    KERNEL_LEVEL_AVX2
+} kernel_level;
+
+/**
+ * Determines (once) the most capable kernel implementation supported by this machine.
+ * @return Returns the kernel level to dispatch to.
+ */
+static kernel_level detect_kernel_level(void) {
+
+    static int level = -1;
+
+    if (level < 0) {
+#ifdef BSTD_KERNELS_X86
+        __builtin_cpu_init();
+        level = __builtin_cpu_supports("avx2") ? KERNEL_LEVEL_AVX2
+                : __builtin_cpu_supports("sse4.2") ? KERNEL_LEVEL_SSE42
+                : KERNEL_LEVEL_SCALAR;
+#else
+        level = KERNEL_LEVEL_SCALAR;
+#endif
+    }
+
+    return (kernel_level) level;
+}
+
+static void dispatch_add(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned, bool subtract) {
+
+    switch (detect_kernel_level()) {
+#ifdef BSTD_KERNELS_X86
+        case KERNEL_LEVEL_AVX2:
+            add_avx2(lhs, rhs, n, limit, isSigned, subtract);
+            return;
+        case KERNEL_LEVEL_SSE42:
+            add_sse42(lhs, rhs, n, limit, isSigned, subtract);
+            return;
+#endif
+        default:
+            add_scalar(lhs, rhs, n, limit, isSigned, subtract);
+            return;
+    }
+}
+
+void bstd_kernel_add(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned) {
+    dispatch_add(lhs, rhs, n, limit, isSigned, false);
+}
+
+void bstd_kernel_subtract(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned) {
+    dispatch_add(lhs, rhs, n, limit, isSigned, true);
+}
+
+void bstd_kernel_add_scalar(int64_t *lhs, int64_t rhs, size_t n, int64_t limit, bool isSigned) {
+
+    switch (detect_kernel_level()) {
+#ifdef BSTD_KERNELS_X86
+        case KERNEL_LEVEL_AVX2:
+            add_broadcast_avx2(lhs, rhs, n, limit, isSigned);
+            return;
+        case KERNEL_LEVEL_SSE42:
+            add_broadcast_sse42(lhs, rhs, n, limit, isSigned);
+            return;
+#endif
+        default:
+            add_broadcast_scalar(lhs, rhs, n, limit, isSigned);
+            return;
+    }
+}
+
+void bstd_kernel_mask_digits(char *dst, const unsigned char *src, size_t n) {
+
+    switch (detect_kernel_level()) {
+#ifdef BSTD_KERNELS_X86
+        case KERNEL_LEVEL_AVX2:
+            mask_digits_avx2(dst, src, n);
+            return;
+        case KERNEL_LEVEL_SSE42:
+            mask_digits_sse42(dst, src, n);
+            return;
+#endif
+        default:
+            mask_digits_scalar(dst, src, n);
+            return;
+    }
+}
+
+void bstd_kernel_unmask_digits(unsigned char *dst, const char *src, size_t n) {
+
+    switch (detect_kernel_level()) {
+#ifdef BSTD_KERNELS_X86
+        case KERNEL_LEVEL_AVX2:
+            unmask_digits_avx2(dst, src, n);
+            return;
+        case KERNEL_LEVEL_SSE42:
+            unmask_digits_sse42(dst, src, n);
+            return;
+#endif
+        default:
+            unmask_digits_scalar(dst, src, n);
+            return;
+    }
+}
+
+void bstd_kernel_mask_alpha(unsigned char *dst, const unsigned char *src, size_t n) {
+
+    switch (detect_kernel_level()) {
+#ifdef BSTD_KERNELS_X86
+        case KERNEL_LEVEL_AVX2:
+            mask_alpha_avx2(dst, src, n);
+            return;
+        case KERNEL_LEVEL_SSE42:
+            mask_alpha_sse42(dst, src, n);
+            return;
+#endif
+        default:
+            mask_alpha_scalar(dst, src, n);
+            return;
+    }
+}
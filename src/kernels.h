@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Internal batch kernels over packed, signed, scaled 64-bit values that share a single length.
+ * Every kernel has a scalar implementation and vectorized SSE4.2 and AVX2 implementations, selected at runtime.
+ * Define BSTD_NO_SIMD to build only the scalar implementations.
+ *
+ * The kernels crop results to their length with a single compare-and-subtract, which requires every operand to
+ * already fit that length: for a limit of 10^length, |lhs[i]| < limit and |rhs[i]| < limit.
+ */
+
+/**
+ * Adds rhs[i] to lhs[i] for every i < n, cropping each sum to the specified limit.
+ * @param lhs The values to add to, which receive the sums.
+ * @param rhs The values to add.
+ * @param n The number of values.
+ * @param limit Ten to the power of the shared length; at most 10^18.
+ * @param isSigned If false, the sign of each sum is dropped.
+ */
+void bstd_kernel_add(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned);
+
+/**
+ * Subtracts rhs[i] from lhs[i] for every i < n, cropping each difference to the specified limit.
+ * @param lhs The values to subtract from, which receive the differences.
+ * @param rhs The values to subtract.
+ * @param n The number of values.
+ * @param limit Ten to the power of the shared length; at most 10^18.
+ * @param isSigned If false, the sign of each difference is dropped.
+ */
+void bstd_kernel_subtract(int64_t *lhs, const int64_t *rhs, size_t n, int64_t limit, bool isSigned);
+
+/**
+ * Adds the specified scalar to lhs[i] for every i < n, cropping each sum to the specified limit.
+ * @param lhs The values to add to, which receive the sums.
+ * @param rhs The value to add to every element.
+ * @param n The number of values.
+ * @param limit Ten to the power of the shared length; at most 10^18.
+ * @param isSigned If false, the sign of each sum is dropped.
+ */
+void bstd_kernel_add_scalar(int64_t *lhs, int64_t rhs, size_t n, int64_t limit, bool isSigned);
+
+/*
+ * Picture kernels over runs of bytes that share a single mask. Bytes and characters follow bstd_mask and bstd_unmask.
+ */
+
+/**
+ * Masks n bytes under the '9' mask: dst[i] = '0' + src[i] % 10.
+ * @param dst The characters to write.
+ * @param src The bytes to mask.
+ * @param n The number of bytes.
+ */
+void bstd_kernel_mask_digits(char *dst, const unsigned char *src, size_t n);
+
+/**
+ * Unmasks n characters under the '9' mask: dst[i] is the digit src[i] represents, or zero if it is not a digit.
+ * @param dst The bytes to write.
+ * @param src The characters to unmask.
+ * @param n The number of characters.
+ */
+void bstd_kernel_unmask_digits(unsigned char *dst, const char *src, size_t n);
+
+/**
+ * Masks or unmasks n bytes under the 'A' mask, which are the same operation: letters are kept and all else is blanked.
+ * @param dst The bytes to write.
+ * @param src The bytes to mask or unmask.
+ * @param n The number of bytes.
+ */
+void bstd_kernel_mask_alpha(unsigned char *dst, const unsigned char *src, size_t n);
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdint.h>
+#include "../include/picutils.h"
+
+/*
+ * Internal translation tables for picture masks, generated at compile time.
+ * Every mask character selects a mask kind; every kind has a 256-entry table from byte to character (mask),
+ * from character to byte (unmask), and from the byte under one kind to the byte under another (move).
+ */
+
+/**
+ * The kinds of mask characters. Characters that are not a known mask behave as 'X'.
+ */
+typedef enum bstd_mask_kind_t {
+    BSTD_MASK_KIND_X = 0,
+    BSTD_MASK_KIND_A = 1,
+    BSTD_MASK_KIND_9 = 2,
+} bstd_mask_kind;
+
+/**
+ * The number of mask kinds.
+ */
+#define BSTD_MASK_KINDS 3
+
+/*
+ * Expands F(n) for every n in [0, 256), separated by commas.
+ */
+#define BSTD_TABLE_4(F, n) F(n), F((n) + 1), F((n) + 2), F((n) + 3)
+#define BSTD_TABLE_16(F, n) BSTD_TABLE_4(F, n), BSTD_TABLE_4(F, (n) + 4), BSTD_TABLE_4(F, (n) + 8), BSTD_TABLE_4(F, (n) + 12)
+#define BSTD_TABLE_64(F, n) BSTD_TABLE_16(F, n), BSTD_TABLE_16(F, (n) + 16), BSTD_TABLE_16(F, (n) + 32), BSTD_TABLE_16(F, (n) + 48)
+#define BSTD_TABLE_256(F) { BSTD_TABLE_64(F, 0), BSTD_TABLE_64(F, 64), BSTD_TABLE_64(F, 128), BSTD_TABLE_64(F, 192) }
+
+/*
+ * The translation of a single byte or character under every kind of mask.
+ * 'A' accepts the ASCII letters only, as isalpha does in the "C" locale; '9' keeps the least-significant decimal digit.
+ */
+#define BSTD_IS_ALPHA(c) (((c) >= 'A' && (c) <= 'Z') || ((c) >= 'a' && (c) <= 'z'))
+#define BSTD_MASK_X_OF(b) ((unsigned char) (b))
+#define BSTD_MASK_A_OF(b) ((unsigned char) (BSTD_IS_ALPHA(b) ? (b) : BSTD_SPACE))
+#define BSTD_MASK_9_OF(b) ((unsigned char) ('0' + (b) % 10))
+#define BSTD_UNMASK_X_OF(c) ((unsigned char) (c))
+#define BSTD_UNMASK_A_OF(c) ((unsigned char) (BSTD_IS_ALPHA(c) ? (c) : BSTD_SPACE))
+#define BSTD_UNMASK_9_OF(c) ((unsigned char) ((c) >= '0' && (c) <= '9' ? (c) - '0' : 0))
+
+#define BSTD_MOVE_X_X(b) BSTD_UNMASK_X_OF(BSTD_MASK_X_OF(b))
+#define BSTD_MOVE_X_A(b) BSTD_UNMASK_A_OF(BSTD_MASK_X_OF(b))
+#define BSTD_MOVE_X_9(b) BSTD_UNMASK_9_OF(BSTD_MASK_X_OF(b))
+#define BSTD_MOVE_A_X(b) BSTD_UNMASK_X_OF(BSTD_MASK_A_OF(b))
+#define BSTD_MOVE_A_A(b) BSTD_UNMASK_A_OF(BSTD_MASK_A_OF(b))
+#define BSTD_MOVE_A_9(b) BSTD_UNMASK_9_OF(BSTD_MASK_A_OF(b))
+#define BSTD_MOVE_9_X(b) BSTD_UNMASK_X_OF(BSTD_MASK_9_OF(b))
+#define BSTD_MOVE_9_A(b) BSTD_UNMASK_A_OF(BSTD_MASK_9_OF(b))
+#define BSTD_MOVE_9_9(b) BSTD_UNMASK_9_OF(BSTD_MASK_9_OF(b))
+
+/**
+ * The kind of every mask character.
+ */
+static const uint8_t bstd_mask_kinds[256] = {
+        [BSTD_MASK_X] = BSTD_MASK_KIND_X,
+        [BSTD_MASK_A] = BSTD_MASK_KIND_A,
+        [BSTD_MASK_9] = BSTD_MASK_KIND_9,
+};
+
+/**
+ * The character of every byte under every kind of mask: bstd_mask_table[kind][byte].
+ */
+static const unsigned char bstd_mask_table[BSTD_MASK_KINDS][256] = {
+        BSTD_TABLE_256(BSTD_MASK_X_OF),
+        BSTD_TABLE_256(BSTD_MASK_A_OF),
+        BSTD_TABLE_256(BSTD_MASK_9_OF),
+};
+
+/**
+ * The byte of every character under every kind of mask: bstd_unmask_table[kind][character].
+ */
+static const unsigned char bstd_unmask_table[BSTD_MASK_KINDS][256] = {
+        BSTD_TABLE_256(BSTD_UNMASK_X_OF),
+        BSTD_TABLE_256(BSTD_UNMASK_A_OF),
+        BSTD_TABLE_256(BSTD_UNMASK_9_OF),
+};
+
+/**
+ * The byte a move stores for every byte, by source and destination kind: bstd_move_table[source][destination][byte].
+ * Equal to unmasking the byte's masked character under the destination kind.
+ */
+static const unsigned char bstd_move_table[BSTD_MASK_KINDS][BSTD_MASK_KINDS][256] = {
+        { BSTD_TABLE_256(BSTD_MOVE_X_X), BSTD_TABLE_256(BSTD_MOVE_X_A), BSTD_TABLE_256(BSTD_MOVE_X_9) },
+        { BSTD_TABLE_256(BSTD_MOVE_A_X), BSTD_TABLE_256(BSTD_MOVE_A_A), BSTD_TABLE_256(BSTD_MOVE_A_9) },
+        { BSTD_TABLE_256(BSTD_MOVE_9_X), BSTD_TABLE_256(BSTD_MOVE_9_A), BSTD_TABLE_256(BSTD_MOVE_9_9) },
+};
+
+/**
+ * Gets the kind of the specified mask character.
+ */
+static inline bstd_mask_kind bstd_mask_kind_of(char mask) {
+    return (bstd_mask_kind) bstd_mask_kinds[(unsigned char) mask];
+}
+
+/**
+ * The default byte of every mask character: a space for 'X' and 'A', and zero for '9' and unknown masks.
+ */
+static const unsigned char bstd_mask_defaults[256] = {
+        [BSTD_MASK_X] = BSTD_SPACE,
+        [BSTD_MASK_A] = BSTD_SPACE,
+};
@@ -1,11 +1,18 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "../include/numutils.h"
 #include "../include/arithmetic.h"
+#include "decimal.h"
+#include "allocation.h"
 
 bstd_number* bstd_number_from_int(int value, uint64_t length, bool isSigned) {
+    return bstd_number_from_int_arena(NULL, value, length, isSigned);
+}
+
+bstd_number* bstd_number_from_int_arena(bstd_arena* arena, int value, uint64_t length, bool isSigned) {
 
-    bstd_number* number = malloc(sizeof(bstd_number));
+    bstd_number* number = bstd_allocate(arena, sizeof(bstd_number));
 
     (*number) = (bstd_number) {
         .value = 0,
@@ -24,100 +31,240 @@ int bstd_number_is_integer(const bstd_number* number) {
     return !number->scale;
 }
 
-static int64_t number_to_signed_value(const bstd_number* number) {
-    return !number->positive && number->isSigned ? -number->value : number->value;
-}
-
 int64_t bstd_number_to_int(const bstd_number* number) {
 
     if (bstd_number_is_integer(number)) {
-        return number_to_signed_value(number);
+        return (int64_t) bstd_signed_value(number);
     }
 
-    return (int64_t) bstd_number_to_double(number);
+    return (int64_t) bstd_rescale(bstd_signed_value(number), number->scale, 0);
 }
 
 double bstd_number_to_double(const bstd_number* number) {
-    return number_to_signed_value(number) / (double)ipow(10, number->scale);
+    return (double) bstd_signed_value(number) / (double) bstd_pow10_table[number->scale];
 }
 
 void bstd_assign_number(bstd_number* assignee, const bstd_number* value) {
+    bstd_store_scaled(assignee, bstd_rescale(bstd_signed_value(value), value->scale, assignee->scale));
+}
 
-    if (bstd_number_is_integer(value)) {
+void bstd_assign_int(bstd_number* number, const int value) {
+    bstd_assign_int64(number, value);
+}
 
-        const int64_t value_conv = bstd_number_to_int(value);
+void bstd_assign_int64(bstd_number* number, const int64_t value) {
+    bstd_store_scaled(number, bstd_rescale(value, 0, number->scale));
+}
 
-        if (bstd_number_is_integer(assignee)) {
-            bstd_assign_int64(assignee, value_conv);
-        } else {
-            bstd_assign_double(assignee, (double)value_conv);
-        }
+bool bstd_assign_number_checked(bstd_number* assignee, const bstd_number* value) {
+    return bstd_store_scaled_checked(assignee, bstd_rescale(bstd_signed_value(value), value->scale, assignee->scale));
+}
 
-    } else {
+bool bstd_assign_int64_checked(bstd_number* number, const int64_t value) {
+    return bstd_store_scaled_checked(number, bstd_rescale(value, 0, number->scale));
+}
+
+void bstd_assign_double(bstd_number* number, const double value) {
 
-        const double value_conv = bstd_number_to_double(value);
+    // the conversion truncates any digits beyond the number's scale towards zero
+    const int64_t shifted = (int64_t) (value * (double) bstd_pow10_table[number->scale]);
 
-        if (bstd_number_is_integer(assignee)) {
-            bstd_assign_int64(assignee, (int64_t)value_conv);
-        } else {
-            bstd_assign_double(assignee, value_conv);
-        }
-    }
+    bstd_store_scaled(number, shifted);
+    number->positive = value >= 0;
 }
 
-void bstd_assign_int(bstd_number* number, const int value) {
-    bstd_assign_int64(number, value);
+int bstd_number_compare(const bstd_number* lhs, const bstd_number* rhs) {
+
+    // zero is never negative, whatever its sign flag says
+    const bool lhsNegative = bstd_is_negative(lhs) && lhs->value != 0;
+    const bool rhsNegative = bstd_is_negative(rhs) && rhs->value != 0;
+
+    if (lhsNegative != rhsNegative) {
+        return lhsNegative ? -1 : 1;
+    }
+
+    int order;
+
+    if (lhs->scale == rhs->scale) {
+        order = (lhs->value > rhs->value) - (lhs->value < rhs->value);
+    } else {
+        order = bstd_compare_magnitudes(lhs->value, lhs->scale, rhs->value, rhs->scale);
+    }
+
+    return lhsNegative ? -order : order;
 }
 
-void bstd_assign_int64(bstd_number* number, const int64_t value) {
+/**
+ * Writes the specified value to the specified buffer as eight big-endian bytes, complementing them if requested.
+ */
+static void write_key_word(unsigned char* key, uint64_t value, uint64_t complement) {
 
-    int64_t abs_value = labs(value);
-    int64_t mag = ipow(10, number->length - number->scale);
-    int64_t mask = (abs_value / mag) * mag;
-    int64_t cropped_value = (abs_value - mask) * ipow(10, number->scale);
+    value ^= complement;
 
-    number->positive = !number->isSigned || value >= 0;
-    number->value = cropped_value;
+    for (int i = 7; i >= 0; --i) {
+        key[i] = (unsigned char) value;
+        value >>= 8;
+    }
 }
 
-void bstd_assign_double(bstd_number* number, const double value) {
+void bstd_number_sort_key(const bstd_number* number, unsigned char* key) {
 
-    int64_t mag1 = ipow(10, number->length);
-    int64_t mag2 = ipow(10, number->scale);
-    int64_t shift = (int64_t)(value * mag2);
-    int64_t mask = (int64_t)((double)shift / mag1) * mag1;
-    int64_t cropped_value = labs(shift - mask);
+    const uint64_t unit = bstd_pow10_table[number->scale];
+    const uint64_t integer = number->value / unit;
+    const uint64_t fraction = (number->value % unit) * bstd_pow10_table[BSTD_POW10_MAX_EXP - number->scale];
 
-    number->positive = value >= 0;
-    number->value = cropped_value;
+    // larger magnitudes sort lower among negative numbers; zero is never negative
+    const bool negative = bstd_is_negative(number) && number->value != 0;
+    const uint64_t complement = negative ? UINT64_MAX : 0;
+
+    key[0] = negative ? 0x00 : 0x01;
+    write_key_word(key + 1, integer, complement);
+    write_key_word(key + 9, fraction, complement);
 }
 
 bool bstd_greater_than(const bstd_number* lhs, const bstd_number* rhs) {
+    return bstd_number_compare(lhs, rhs) > 0;
+}
 
-    const int64_t lhsInt = bstd_number_to_int(lhs);
-    const int64_t rhsInt = bstd_number_to_int(rhs);
+bool bstd_less_than(const bstd_number* lhs, const bstd_number* rhs) {
+    return bstd_number_compare(lhs, rhs) < 0;
+}
 
-    return lhsInt > rhsInt;
+bool bstd_number_equals(const bstd_number* lhs, const bstd_number* rhs) {
+    return bstd_number_compare(lhs, rhs) == 0;
 }
 
-bool bstd_less_than(const bstd_number* lhs, const bstd_number* rhs) {
+size_t bstd_number_format_into(char* buf, size_t cap, const bstd_number* number) {
+
+    const size_t digits = number->length > number->scale ? number->length : number->scale;
+    const size_t size = (number->isSigned ? 1 : 0) + digits + (number->scale > 0 ? 1 : 0);
+
+    if (digits > BSTD_POW10_MAX_EXP) {
+        return BSTD_NUMBER_FORMAT_ERROR;
+    }
+
+    if (size >= cap) {
+        return size;
+    }
+
+    uint64_t value = number->value % bstd_pow10_table[digits];
 
-    const int64_t lhsInt = bstd_number_to_int(lhs);
-    const int64_t rhsInt = bstd_number_to_int(rhs);
+    // write all digits right-aligned, two per step, leaving room for the decimal point
+    char scratch[BSTD_POW10_MAX_EXP + 1];
+    char* end = scratch + digits;
+    char* p = end;
 
-    return lhsInt < rhsInt;
+    while (p - scratch >= 2) {
+        const uint64_t pair = value % 100;
+        value /= 100;
+        p -= 2;
+        p[0] = bstd_digit_pairs[2 * pair];
+        p[1] = bstd_digit_pairs[2 * pair + 1];
+    }
+
+    if (p > scratch) {
+        *--p = (char) ('0' + value);
+    }
+
+    char* out = buf;
+
+    if (number->isSigned) {
+        *out++ = bstd_is_negative(number) && number->value != 0 ? '-' : '+';
+    }
+
+    const size_t integer_digits = digits - number->scale;
+
+    memcpy(out, scratch, integer_digits);
+    out += integer_digits;
+
+    if (number->scale > 0) {
+        *out++ = '.';
+        memcpy(out, scratch + integer_digits, number->scale);
+        out += number->scale;
+    }
+
+    *out = '\0';
+
+    return size;
 }
 
-bool bstd_number_equals(const bstd_number* lhs, const bstd_number* rhs) {
+bool bstd_number_parse(bstd_number* number, const char* str, size_t len) {
+
+    const char* p = str;
+    const char* end = str + len;
+
+    while (p < end && *p == ' ') {
+        ++p;
+    }
+    while (end > p && end[-1] == ' ') {
+        --end;
+    }
+
+    bool negative = false;
+
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    const char* point = memchr(p, '.', (size_t) (end - p));
+    const char* integer = p;
+    const char* integer_end = point ? point : end;
+    const char* fraction = point ? point + 1 : end;
+
+    if (integer == integer_end && fraction == end) {
+        // there is not a single digit
+        return false;
+    }
+
+    // leading zeros do not count towards the 19 digits
+    while (integer < integer_end && *integer == '0') {
+        ++integer;
+    }
+
+    // fractional digits beyond the assignee's scale are truncated, but must still be digits
+    const size_t fraction_digits = (size_t) (end - fraction);
+    const size_t kept_digits = fraction_digits < number->scale ? fraction_digits : number->scale;
+    uint64_t integer_value;
+    uint64_t fraction_value;
+    uint64_t dropped_value;
+
+    if ((size_t) (integer_end - integer) > BSTD_POW10_MAX_EXP || kept_digits > BSTD_POW10_MAX_EXP
+        || !bstd_parse_digits(integer, (size_t) (integer_end - integer), &integer_value)
+        || !bstd_parse_digits(fraction, kept_digits, &fraction_value)) {
+        return false;
+    }
+
+    for (const char* q = fraction + kept_digits; q < end; q += BSTD_POW10_MAX_EXP) {
+        const size_t n = (size_t) (end - q) < BSTD_POW10_MAX_EXP ? (size_t) (end - q) : BSTD_POW10_MAX_EXP;
+        if (!bstd_parse_digits(q, n, &dropped_value)) {
+            return false;
+        }
+    }
+
+    const __int128 magnitude = (__int128) integer_value * (__int128) bstd_pow10_u128(kept_digits) + fraction_value;
+
+    bstd_store_scaled(number, bstd_rescale(negative ? -magnitude : magnitude, kept_digits, number->scale));
+    return true;
+}
 
-    const int64_t lhsInt = bstd_number_to_int(lhs);
-    const int64_t rhsInt = bstd_number_to_int(rhs);
+size_t bstd_number_parse_n(bstd_number* numbers, const char* data, size_t width, size_t n) {
 
-    return lhsInt == rhsInt;
+    size_t parsed = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        parsed += bstd_number_parse(&numbers[i], data + i * width, width);
+    }
+
+    return parsed;
 }
 
 // TODO: Sign should be included in the string
 char *bstd_number_to_cstr(bstd_number number) {
+    return bstd_number_to_cstr_arena(NULL, number);
+}
+
+char *bstd_number_to_cstr_arena(bstd_arena* arena, bstd_number number) {
 
     char format[9];
     char* result;
@@ -126,7 +273,7 @@ char *bstd_number_to_cstr(bstd_number number) {
     if (bstd_number_is_integer(&number)) {
 
         sprintf(format, "%%ld");
-        result = malloc(sizeof(char*) * (number.length + 1));
+        result = bstd_allocate(arena, sizeof(char*) * (number.length + 1));
 
         const int64_t value = bstd_number_to_int(&number);
         sprintf(result, format, value);
@@ -134,7 +281,7 @@ char *bstd_number_to_cstr(bstd_number number) {
     } else {
 
         sprintf(format, "%%0%d.%ldf", (int)number.length + 1, number.scale);
-        result = malloc(sizeof(char*) * (number.length + 2));
+        result = bstd_allocate(arena, sizeof(char*) * (number.length + 2));
 
         const double value = bstd_number_to_double(&number);
         sprintf(result, format, value);
@@ -143,20 +290,10 @@ char *bstd_number_to_cstr(bstd_number number) {
     return result;
 }
 
-// TODO: Sign gets calculated here, but should be calculated in bstd_number_to_cstr!
 void bstd_print_number(bstd_number number, bool spacer) {
-    char *str = bstd_number_to_cstr(number);
-    if (spacer) {
-        if (number.positive && number.isSigned) {
-            printf(" +%s", str);
-        } else {
-            printf(" %s", str);
-        }
-    } else {
-        if (number.positive && number.isSigned) {
-            printf("+%s", str);
-        } else {
-            printf("%s", str);
-        }
-    }
+
+    char str[BSTD_NUMBER_FORMAT_MAX_SIZE] = "";
+    bstd_number_format_into(str, sizeof(str), &number);
+
+    printf(spacer ? " %s" : "%s", str);
 }
@@ -1,19 +1,166 @@
 #include "../include/picutils.h"
-#include <math.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
+#include "allocation.h"
+#include "masks.h"
+#include "kernels.h"
+#include "registry.h"
+
+/**
+ * The shortest run worth handing to a picture kernel; shorter runs are translated through the mask tables.
+ */
+#define BSTD_KERNEL_MIN_RUN 16
+
+/**
+ * Storage for the layout of any picture, for operations on pictures without a compiled layout.
+ */
+typedef struct layout_storage_t {
+    _Alignas(bstd_picture_layout) unsigned char bytes[BSTD_PICTURE_LAYOUT_SIZE(UINT8_MAX)];
+} layout_storage;
+
+/**
+ * Gets the layout of the specified picture, compiling it into the specified storage if the picture has none.
+ */
+static const bstd_picture_layout *layout_of(const bstd_picture *picture, layout_storage *storage) {
+
+    if (picture->layout != NULL) {
+        return picture->layout;
+    }
+
+    bstd_picture_layout *layout = (bstd_picture_layout *) storage->bytes;
+    bstd_compile_layout(picture->mask, picture->length, layout);
+
+    return layout;
+}
+
+/**
+ * Masks a run of bytes that share the specified mask.
+ */
+static void mask_run(char *dst, const unsigned char *src, size_t n, char mask) {
+
+    if (n < BSTD_KERNEL_MIN_RUN) {
+        const unsigned char *table = bstd_mask_table[bstd_mask_kind_of(mask)];
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = (char) table[src[i]];
+        }
+        return;
+    }
+
+    switch (bstd_mask_kind_of(mask)) {
+        case BSTD_MASK_KIND_A:
+            bstd_kernel_mask_alpha((unsigned char *) dst, src, n);
+            break;
+        case BSTD_MASK_KIND_9:
+            bstd_kernel_mask_digits(dst, src, n);
+            break;
+        default:
+            memcpy(dst, src, n);
+    }
+}
+
+/**
+ * Unmasks a run of characters into bytes that share the specified mask.
+ */
+static void unmask_run(unsigned char *dst, const char *src, size_t n, char mask) {
+
+    if (n < BSTD_KERNEL_MIN_RUN) {
+        const unsigned char *table = bstd_unmask_table[bstd_mask_kind_of(mask)];
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = table[(unsigned char) src[i]];
+        }
+        return;
+    }
+
+    switch (bstd_mask_kind_of(mask)) {
+        case BSTD_MASK_KIND_A:
+            bstd_kernel_mask_alpha(dst, (const unsigned char *) src, n);
+            break;
+        case BSTD_MASK_KIND_9:
+            bstd_kernel_unmask_digits(dst, src, n);
+            break;
+        default:
+            memcpy(dst, src, n);
+    }
+}
+
+/**
+ * Moves a run of bytes under one kind of mask to bytes under another, as masking and unmasking every byte would.
+ * The source and destination may overlap only if they are equal.
+ */
+static void move_run(unsigned char *dst, const unsigned char *src, size_t n, bstd_mask_kind from, bstd_mask_kind to) {
+
+    if (from == BSTD_MASK_KIND_X && to == BSTD_MASK_KIND_X) {
+        memmove(dst, src, n);
+        return;
+    }
+
+    const unsigned char *move = bstd_move_table[from][to];
+
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = move[src[i]];
+    }
+}
+
+/**
+ * Sets up the picture of the specified interned mask in the specified memory, leaving its bytes uninitialized.
+ * The picture points at the interned copy of its mask, which it shares with every picture of the same mask.
+ * @param memory The memory for the picture. Must hold BSTD_PICTURE_SIZE(interned->length) bytes.
+ * @param interned The interned mask of the picture.
+ * @return Returns the picture.
+ */
+static bstd_picture *picture_in(void *memory, const bstd_interned_mask *interned) {
+
+    bstd_picture *picture = memory;
+
+    picture->bytes = picture->data;
+    picture->mask = interned->mask;
+    picture->length = interned->length;
+    picture->layout = bstd_interned_layout(interned);
+
+    return picture;
+}
+
+/**
+ * Allocates a picture of the specified mask from the specified arena, leaving its bytes uninitialized.
+ * The picture holds its bytes inline, so it is a single allocation. If the mask cannot be interned, the picture holds
+ * its own copy of the mask after its bytes instead, and has no layout.
+ * @param arena The arena to allocate the picture from, or NULL to allocate it with the current allocator.
+ * @param mask The mask of the picture.
+ * @param length The length of the picture.
+ * @return Returns the new picture, or NULL if it could not be allocated.
+ */
+static bstd_picture *picture_allocate(bstd_arena *arena, const char *mask, uint8_t length) {
+
+    const bstd_interned_mask *interned = bstd_intern_mask(mask, length);
+
+    if (interned != NULL) {
+        void *memory = bstd_allocate(arena, BSTD_PICTURE_SIZE(length));
+        return memory != NULL ? picture_in(memory, interned) : NULL;
+    }
+
+    bstd_picture *picture = bstd_allocate(arena, BSTD_PICTURE_SIZE(length) + length);
+
+    if (picture != NULL) {
+        picture->bytes = picture->data;
+        picture->mask = memcpy(picture->data + length, mask, length);
+        picture->length = length;
+        picture->layout = NULL;
+    }
+
+    return picture;
+}
 
 bstd_picture* bstd_create_picture(char *mask_str) {
+    return bstd_create_picture_arena(NULL, mask_str);
+}
 
-    uint8_t length = strlen(mask_str);
-    unsigned char *bytes = (unsigned char *) malloc(sizeof(unsigned char) * length);
+bstd_picture* bstd_create_picture_arena(bstd_arena *arena, char *mask_str) {
 
-    // bytes can contain garbage, we will initialize the picture shortly
-    bstd_picture *picture = bstd_picture_of(bytes, mask_str, length);
+    bstd_picture *picture = picture_allocate(arena, mask_str, strlen(mask_str));
 
-    free(bytes); // byte contents were copied, we should release the memory
+    if (picture == NULL) {
+        return NULL;
+    }
 
     // initialize picture bytes to the default value under its mask_str
     bstd_picture_init(picture);
@@ -22,14 +169,18 @@ bstd_picture* bstd_create_picture(char *mask_str) {
 }
 
 bstd_picture *bstd_picture_of(unsigned char *bytes, char *mask, uint8_t length) {
+    return bstd_picture_of_arena(NULL, bytes, mask, length);
+}
+
+bstd_picture *bstd_picture_of_arena(bstd_arena *arena, unsigned char *bytes, char *mask, uint8_t length) {
 
-    unsigned char *b = (unsigned char *) malloc(sizeof(unsigned char) * length);
-    char *m = (char *) malloc(sizeof(char) * length);
+    bstd_picture *picture = picture_allocate(arena, mask, length);
+
+    if (picture == NULL) {
+        return NULL;
+    }
 
-    bstd_picture *picture = (bstd_picture *) malloc(sizeof(bstd_picture));
-    picture->bytes = memcpy(b, bytes, length);
-    picture->mask = memcpy(m, mask, length);
-    picture->length = length;
+    memcpy(picture->bytes, bytes, length);
 
     // todo: ensure that the bytes do not violate the mask
 
@@ -44,8 +195,18 @@ bstd_picture *bstd_picture_of(unsigned char *bytes, char *mask, uint8_t length)
  */
 static void bstd_picture_init_range(bstd_picture* picture, size_t start, size_t end) {
 
-    for (unsigned int i = start; i < end; ++i) {
-        picture->bytes[i] = bstd_default_value(picture->mask[i]);
+    layout_storage storage;
+    const bstd_picture_layout *layout = layout_of(picture, &storage);
+
+    for (uint8_t r = 0; r < layout->count && start < end; ++r) {
+        const bstd_mask_run run = layout->runs[r];
+        const size_t run_end = (size_t) run.start + run.length;
+        if (run_end <= start) {
+            continue;
+        }
+        const size_t n = (run_end < end ? run_end : end) - start;
+        memset(picture->bytes + start, bstd_mask_defaults[(unsigned char) run.mask], n);
+        start += n;
     }
 }
 
@@ -53,6 +214,27 @@ void bstd_picture_init(bstd_picture* picture) {
     bstd_picture_init_range(picture, 0, picture->length);
 }
 
+bstd_picture* bstd_picture_init_in(bstd_picture_storage *storage, const char *mask_str) {
+
+    const size_t length = strlen(mask_str);
+
+    if (length > BSTD_PICTURE_INLINE_SIZE) {
+        return NULL;
+    }
+
+    // the storage has no room for a copy of the mask
+    const bstd_interned_mask *interned = bstd_intern_mask(mask_str, (uint8_t) length);
+
+    if (interned == NULL) {
+        return NULL;
+    }
+
+    bstd_picture *picture = picture_in(storage, interned);
+    bstd_picture_init(picture);
+
+    return picture;
+}
+
 void bstd_assign_picture(bstd_picture *assignee, const bstd_picture *value) {
 
     // the number of bytes to copy
@@ -68,20 +250,58 @@ void bstd_assign_picture(bstd_picture *assignee, const bstd_picture *value) {
         bstd_picture_init_range(assignee, value->length, assignee->length);
     }
 
-    // assign values left-to-right
-    for (int i = 0; i < n; ++i) {
-        const char c = bstd_mask(value->bytes[i], value->mask[i]);
-        assignee->bytes[i] = bstd_unmask(c, assignee->mask[i]);
+    const bstd_interned_mask *to_mask = bstd_interned_of(assignee->layout);
+    const bstd_interned_mask *from_mask = bstd_interned_of(value->layout);
+    const bstd_move_plan *plan = to_mask != NULL && from_mask != NULL ? bstd_move_plan_of(to_mask, from_mask) : NULL;
+
+    if (plan != NULL) {
+        // pictures of interned masks replay the cached plan for their pair of masks
+        for (uint8_t s = 0; s < plan->count; ++s) {
+            const bstd_move_segment segment = plan->segments[s];
+            move_run(assignee->bytes + segment.start, value->bytes + segment.start, segment.length, segment.from, segment.to);
+        }
+        return;
+    }
+
+    layout_storage to_storage, from_storage;
+    const bstd_picture_layout *to = layout_of(assignee, &to_storage);
+    const bstd_picture_layout *from = layout_of(value, &from_storage);
+
+    // assign values left-to-right, one segment of equal masks in both pictures at a time
+    size_t i = 0;
+    uint8_t t = 0, f = 0;
+
+    while (i < n) {
+        const bstd_mask_run to_run = to->runs[t];
+        const bstd_mask_run from_run = from->runs[f];
+        const size_t to_end = (size_t) to_run.start + to_run.length;
+        const size_t from_end = (size_t) from_run.start + from_run.length;
+        size_t end = to_end < from_end ? to_end : from_end;
+        end = end < n ? end : n;
+
+        move_run(assignee->bytes + i, value->bytes + i, end - i, bstd_mask_kind_of(from_run.mask), bstd_mask_kind_of(to_run.mask));
+
+        i = end;
+        t += i == to_end;
+        f += i == from_end;
     }
 }
 
 char *bstd_picture_to_cstr(const bstd_picture *picture) {
+    return bstd_picture_to_cstr_arena(NULL, picture);
+}
+
+char *bstd_picture_to_cstr_arena(bstd_arena *arena, const bstd_picture *picture) {
 
-    char *str = (char *) malloc(sizeof(char) * (picture->length + 1));
+    char *str = (char *) bstd_allocate(arena, sizeof(char) * (picture->length + 1));
     str[picture->length] = '\0'; // null terminator
 
-    for (int i = 0; i < picture->length; ++i) {
-        str[i] = bstd_mask(picture->bytes[i], picture->mask[i]);
+    layout_storage storage;
+    const bstd_picture_layout *layout = layout_of(picture, &storage);
+
+    for (uint8_t r = 0; r < layout->count; ++r) {
+        const bstd_mask_run run = layout->runs[r];
+        mask_run(str + run.start, picture->bytes + run.start, run.length, run.mask);
     }
 
     return str;
@@ -104,94 +324,58 @@ void bstd_assign_str(bstd_picture *assignee, const char *str) {
         bstd_picture_init_range(assignee, str_len, assignee->length);
     }
 
-    // unmask and store characters left-to-right
-    for (int i = 0; i < n; ++i) {
-        assignee->bytes[i] = bstd_unmask(str[i], assignee->mask[i]);
+    layout_storage storage;
+    const bstd_picture_layout *layout = layout_of(assignee, &storage);
+
+    // unmask and store characters left-to-right, one run at a time
+    for (uint8_t r = 0; r < layout->count && layout->runs[r].start < n; ++r) {
+        const bstd_mask_run run = layout->runs[r];
+        const size_t run_end = (size_t) run.start + run.length;
+        unmask_run(assignee->bytes + run.start, str + run.start, (run_end < n ? run_end : n) - run.start, run.mask);
     }
 }
 
-unsigned char bstd_default_value(char mask) {
+void bstd_picture_sort_key(const bstd_picture *picture, unsigned char *key, size_t width) {
 
-    switch(mask) {
-        case BSTD_MASK_9:
-            return 0;
-        case BSTD_MASK_X:
-        case BSTD_MASK_A:
-            return BSTD_SPACE;
-        default:
-            return 0;
+    const size_t n = picture->length < width ? picture->length : width;
+
+    layout_storage storage;
+    const bstd_picture_layout *layout = layout_of(picture, &storage);
+
+    for (uint8_t r = 0; r < layout->count && layout->runs[r].start < n; ++r) {
+        const bstd_mask_run run = layout->runs[r];
+        const size_t run_end = (size_t) run.start + run.length;
+        mask_run((char *) key + run.start, picture->bytes + run.start, (run_end < n ? run_end : n) - run.start, run.mask);
     }
+
+    memset(key + n, BSTD_SPACE, width - n);
+}
+
+unsigned char bstd_default_value(char mask) {
+    return bstd_mask_defaults[(unsigned char) mask];
 }
 
 char bstd_mask(unsigned char byte, char mask) {
 
     /*
      * 'X' => byte
-     * 'A' => isalpha(byte) ? byte : SPACE
+     * 'A' => is_ascii_letter(byte) ? byte : SPACE
      * '9' => least_significant_digit(byte)
      */
 
-    int size;
-    char *str;
-
-    switch (mask) {
-        case BSTD_MASK_X:
-            return (char) byte;
-        case BSTD_MASK_A:
-            if (isalpha(byte)) {
-                return (char) byte;
-            }
-            return BSTD_SPACE;
-        case BSTD_MASK_9:
-            if (byte == 0) {
-                return '0';
-            } else if (byte == 1) {
-                return '1';
-            }
-            size = (int) (ceil(log10(byte)) + 1);
-            str = (char *) malloc(sizeof(char) * size);
-            sprintf(str, "%d", byte);
-            char result = str[size - 2];
-            free(str);
-            return result;
-        default:
-            // todo: warn of unknown mask
-            return (char) byte;
-    }
+    return (char) bstd_mask_table[bstd_mask_kind_of(mask)][byte];
 }
 
 unsigned char bstd_unmask(char c, char mask) {
-
-    switch (mask) {
-        case BSTD_MASK_X:
-            return c;
-        case BSTD_MASK_A:
-            if (isalpha(c)) {
-                return c;
-            }
-            return BSTD_SPACE;
-        case BSTD_MASK_9:
-            if (c >= '0' && c <= '9') {
-                // we can parse this character to a digit
-                return c - '0';
-            }
-            // this character does not represent a digit
-            return 0;
-        default:
-            // todo: warn of unknown mask
-            return c;
-    }
+    return bstd_unmask_table[bstd_mask_kind_of(mask)][(unsigned char) c];
 }
 
 // TODO: Add optional delimiter
-void bstd_print_picture(bstd_picture picture, bool spacer) {
-    if (spacer) {
-        if (picture.length == 0) {
-            printf(" ");
-        } else {
-            printf(" %s", bstd_picture_to_cstr(&picture));
-        }
-    } else {
-        printf("%s", bstd_picture_to_cstr(&picture));
-    }
+void bstd_print_picture(const bstd_picture *picture, bool spacer) {
+
+    char *str = bstd_picture_to_cstr(picture);
+
+    printf(spacer ? " %s" : "%s", str);
+
+    bstd_free(str);
 }
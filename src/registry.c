@@ -0,0 +1,187 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "registry.h"
+#include "masks.h"
+
+/**
+ * The number of hash buckets of the registry. Programs declare a bounded set of masks, so the table does not grow.
+ */
+#define REGISTRY_BUCKETS 1024
+
+static bstd_interned_mask *buckets[REGISTRY_BUCKETS];
+
+/**
+ * Serializes interning and the compilation of move plans; lookups of plans do not take it.
+ */
+static atomic_flag registry_lock = ATOMIC_FLAG_INIT;
+
+static void lock(void) {
+    while (atomic_flag_test_and_set_explicit(&registry_lock, memory_order_acquire)) {
+        // spin; the critical sections are a hash lookup and at most one allocation
+    }
+}
+
+static void unlock(void) {
+    atomic_flag_clear_explicit(&registry_lock, memory_order_release);
+}
+
+/**
+ * Hashes the specified mask with 64-bit FNV-1a.
+ */
+static uint64_t hash_mask(const char *mask, uint8_t length) {
+
+    uint64_t hash = 0xCBF29CE484222325 ^ length;
+
+    for (uint8_t i = 0; i < length; ++i) {
+        hash = (hash ^ (unsigned char) mask[i]) * 0x100000001B3;
+    }
+
+    return hash;
+}
+
+uint8_t bstd_count_runs(const char *mask, uint8_t length) {
+
+    uint8_t count = length > 0;
+
+    for (uint8_t i = 1; i < length; ++i) {
+        count += mask[i] != mask[i - 1];
+    }
+
+    return count;
+}
+
+void bstd_compile_layout(const char *mask, uint8_t length, bstd_picture_layout *layout) {
+
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < length; ++i) {
+        if (i == 0 || mask[i] != mask[i - 1]) {
+            layout->runs[count++] = (bstd_mask_run) { .start = i, .length = 0, .mask = mask[i] };
+        }
+        layout->runs[count - 1].length++;
+    }
+
+    layout->count = count;
+    layout->interned = false;
+}
+
+const bstd_interned_mask *bstd_intern_mask(const char *mask, uint8_t length) {
+
+    const uint64_t hash = hash_mask(mask, length);
+    bstd_interned_mask **bucket = &buckets[hash % REGISTRY_BUCKETS];
+
+    lock();
+
+    for (bstd_interned_mask *interned = *bucket; interned != NULL; interned = interned->next) {
+        if (interned->hash == hash && interned->length == length && memcmp(interned->mask, mask, length) == 0) {
+            unlock();
+            return interned;
+        }
+    }
+
+    const uint8_t runs = bstd_count_runs(mask, length);
+    bstd_interned_mask *interned = malloc(sizeof(bstd_interned_mask) + BSTD_PICTURE_LAYOUT_SIZE(runs) + length);
+
+    if (interned != NULL) {
+        bstd_picture_layout *layout = (bstd_picture_layout *) (interned + 1);
+        char *chars = (char *) layout + BSTD_PICTURE_LAYOUT_SIZE(runs);
+
+        bstd_compile_layout(mask, length, layout);
+        layout->interned = true;
+
+        interned->plans = NULL;
+        interned->hash = hash;
+        interned->mask = memcpy(chars, mask, length);
+        interned->length = length;
+        interned->next = *bucket;
+        *bucket = interned;
+    }
+
+    unlock();
+    return interned;
+}
+
+/**
+ * Finds the cached plan for moving from the specified interned mask in the specified list of plans.
+ */
+static const bstd_move_plan *find_plan(const bstd_move_plan *plan, const bstd_interned_mask *from) {
+
+    while (plan != NULL && plan->from != from) {
+        plan = plan->next;
+    }
+
+    return plan;
+}
+
+/**
+ * Compiles the plan for moving a picture of one interned mask into a picture of another.
+ */
+static bstd_move_plan *compile_plan(const bstd_interned_mask *to_mask, const bstd_interned_mask *from_mask) {
+
+    const bstd_picture_layout *to = bstd_interned_layout(to_mask);
+    const bstd_picture_layout *from = bstd_interned_layout(from_mask);
+    const size_t n = to_mask->length < from_mask->length ? to_mask->length : from_mask->length;
+
+    // every segment ends at the end of a run of either mask
+    bstd_move_plan *plan = malloc(sizeof(bstd_move_plan) + sizeof(bstd_move_segment) * (to->count + from->count));
+
+    if (plan == NULL) {
+        return NULL;
+    }
+
+    size_t i = 0;
+    uint8_t t = 0, f = 0, count = 0;
+
+    while (i < n) {
+        const bstd_mask_run to_run = to->runs[t];
+        const bstd_mask_run from_run = from->runs[f];
+        const size_t to_end = (size_t) to_run.start + to_run.length;
+        const size_t from_end = (size_t) from_run.start + from_run.length;
+        size_t end = to_end < from_end ? to_end : from_end;
+        end = end < n ? end : n;
+
+        plan->segments[count++] = (bstd_move_segment) {
+                .start = (uint8_t) i,
+                .length = (uint8_t) (end - i),
+                .from = bstd_mask_kind_of(from_run.mask),
+                .to = bstd_mask_kind_of(to_run.mask)
+        };
+
+        i = end;
+        t += i == to_end;
+        f += i == from_end;
+    }
+
+    plan->from = from_mask;
+    plan->count = count;
+
+    return plan;
+}
+
+const bstd_move_plan *bstd_move_plan_of(const bstd_interned_mask *to, const bstd_interned_mask *from) {
+
+    bstd_interned_mask *owner = (bstd_interned_mask *) to;
+    const bstd_move_plan *plan = find_plan(atomic_load_explicit(&owner->plans, memory_order_acquire), from);
+
+    if (plan != NULL) {
+        return plan;
+    }
+
+    lock();
+
+    // another thread may have compiled the plan in the meantime
+    plan = find_plan(atomic_load_explicit(&owner->plans, memory_order_relaxed), from);
+
+    if (plan == NULL) {
+        bstd_move_plan *compiled = compile_plan(to, from);
+        if (compiled != NULL) {
+            compiled->next = atomic_load_explicit(&owner->plans, memory_order_relaxed);
+            atomic_store_explicit(&owner->plans, compiled, memory_order_release);
+        }
+        plan = compiled;
+    }
+
+    unlock();
+    return plan;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../include/picture.h"
+
+/*
+ * Internal registry of interned picture masks. Every distinct mask is stored once, together with its compiled layout,
+ * and lives until the program exits; pictures of equal masks share a single interned mask.
+ * Interned masks and move plans are never released, so they are allocated with malloc rather than the allocator hooks:
+ * the hooks only ever see memory that the library hands out to its callers.
+ * Interned masks are immutable, so they are read without locking; only interning itself is serialized.
+ */
+
+/**
+ * A segment of a move between pictures of two interned masks, whose bytes share one mask kind in either picture.
+ */
+typedef struct bstd_move_segment_t {
+    uint8_t start;
+    uint8_t length;
+    uint8_t from;
+    uint8_t to;
+} bstd_move_segment;
+
+/**
+ * The compiled plan for moving a picture of one interned mask into a picture of another.
+ * Plans cover the shorter of both masks and are cached on the interned mask of the destination.
+ */
+typedef struct bstd_move_plan_t {
+    const struct bstd_move_plan_t *next;
+    const struct bstd_interned_mask_t *from;
+    uint8_t count;
+    bstd_move_segment segments[];
+} bstd_move_plan;
+
+/**
+ * An interned mask. Its layout and its characters follow the header in the same allocation:
+ * the layout starts at the end of the header, so the header of an interned layout is found by pointer arithmetic.
+ */
+typedef struct bstd_interned_mask_t {
+    struct bstd_interned_mask_t *next;
+    const bstd_move_plan *_Atomic plans;
+    uint64_t hash;
+    const char *mask;
+    uint8_t length;
+} bstd_interned_mask;
+
+/**
+ * Counts the runs of equal characters in the specified mask.
+ */
+uint8_t bstd_count_runs(const char *mask, uint8_t length);
+
+/**
+ * Compiles the specified mask into the specified layout, which must hold bstd_count_runs(mask, length) runs.
+ * The layout is not marked as interned.
+ */
+void bstd_compile_layout(const char *mask, uint8_t length, bstd_picture_layout *layout);
+
+/**
+ * Interns the specified mask, returning the existing interned mask if an equal one was interned before.
+ * @param mask The characters of the mask; they are copied.
+ * @param length The length of the mask.
+ * @return Returns the interned mask, or NULL if it could not be allocated.
+ */
+const bstd_interned_mask *bstd_intern_mask(const char *mask, uint8_t length);
+
+/**
+ * Gets the compiled layout of the specified interned mask.
+ */
+static inline const bstd_picture_layout *bstd_interned_layout(const bstd_interned_mask *interned) {
+    return (const bstd_picture_layout *) (interned + 1);
+}
+
+/**
+ * Gets the interned mask that owns the specified layout.
+ * @param layout The layout of a picture. May be NULL.
+ * @return Returns the interned mask, or NULL if the layout is not interned.
+ */
+static inline const bstd_interned_mask *bstd_interned_of(const bstd_picture_layout *layout) {
+    return layout != NULL && layout->interned ? (const bstd_interned_mask *) layout - 1 : NULL;
+}
+
+/**
+ * Gets the plan for moving a picture of one interned mask into a picture of another, compiling and caching it on first use.
+ * @param to The interned mask of the destination.
+ * @param from The interned mask of the source.
+ * @return Returns the plan, or NULL if it could not be allocated.
+ */
+const bstd_move_plan *bstd_move_plan_of(const bstd_interned_mask *to, const bstd_interned_mask *from);
@@ -0,0 +1,253 @@
+#include <stdlib.h>
+#include "../include/wideutils.h"
+#include "decimal.h"
+#include "allocation.h"
+
+/**
+ * The maximum number of characters in a C-style string representation of a wide number:
+ * sign, 38 digits, a leading zero, a decimal point and the null terminator.
+ */
+#define WIDE_CSTR_MAX_LENGTH (BSTD_WIDE_NUMBER_MAX_LENGTH + 4)
+
+static bool wide_is_negative(const bstd_wide_number* number) {
+    return number->isSigned && !number->positive && number->value != 0;
+}
+
+/**
+ * Stores the specified magnitude and sign into the specified wide number, following the BabyCobol assignment specifications:
+ * high-order digits that do not fit the number's length are cropped, unsigned numbers drop the sign, and zero is never negative.
+ * @param number The wide number to store the value in. Its constraints are not modified.
+ * @param negative If true, the value is negative.
+ * @param magnitude The magnitude of the value, already at the number's scale.
+ */
+static void wide_store_magnitude(bstd_wide_number* number, bool negative, unsigned __int128 magnitude) {
+
+    if (number->length <= BSTD_WIDE_NUMBER_MAX_LENGTH) {
+        const unsigned __int128 limit = bstd_pow10_u128(number->length);
+        if (magnitude >= limit) {
+            magnitude %= limit;
+        }
+    }
+
+    number->positive = !number->isSigned || !negative || magnitude == 0;
+    number->value = magnitude;
+}
+
+/**
+ * Converts the specified magnitude from one scale to another. Digits beyond the target scale are truncated, and the
+ * result is reduced modulo 10^38, which keeps every digit a wide number can receive; nothing overflows.
+ * @param magnitude The magnitude to convert. Less than 10^38.
+ * @param from The scale of the specified magnitude.
+ * @param to The scale to convert the magnitude to.
+ * @param big Set to true iff the converted magnitude is 10^38 or more before it is reduced.
+ * @return Returns the magnitude at the target scale, modulo 10^38.
+ */
+static unsigned __int128 wide_rescale_magnitude(unsigned __int128 magnitude, uint64_t from, uint64_t to, bool* big) {
+
+    *big = false;
+
+    if (to == from) {
+        return magnitude;
+    }
+
+    if (to < from) {
+        return from - to > BSTD_WIDE_NUMBER_MAX_LENGTH ? 0 : bstd_div_pow10_u128(magnitude, from - to);
+    }
+
+    if (to - from >= BSTD_WIDE_NUMBER_MAX_LENGTH) {
+        *big = magnitude != 0;
+        return 0;
+    }
+
+    // digits that would be shifted past 10^38 are dropped first
+    const unsigned __int128 room = bstd_pow10_u128(BSTD_WIDE_NUMBER_MAX_LENGTH - (to - from));
+    *big = magnitude >= room;
+
+    return (magnitude % room) * bstd_pow10_u128(to - from);
+}
+
+/**
+ * Stores the specified signed magnitude, converted to the specified wide number's scale, into the number.
+ */
+static void wide_store_rescaled(bstd_wide_number* number, bool negative, unsigned __int128 magnitude, uint64_t scale) {
+    bool big;
+    wide_store_magnitude(number, negative, wide_rescale_magnitude(magnitude, scale, number->scale, &big));
+}
+
+/**
+ * Adds the specified signed magnitude at the specified scale to the specified wide number, following the BabyCobol ADD
+ * specifications: the exact sum is truncated to the number's scale and cropped to its length.
+ * The sum is formed in sign-magnitude form in unsigned 128-bit arithmetic, so operands of 38 digits never overflow.
+ * @param lhs The wide number to add to.
+ * @param b_negative If true, the value to add is negative.
+ * @param b The magnitude of the value to add. Less than 10^38.
+ * @param b_scale The scale of the value to add.
+ */
+static void wide_add_magnitude(bstd_wide_number* lhs, bool b_negative, unsigned __int128 b, uint64_t b_scale) {
+
+    const bool a_negative = wide_is_negative(lhs);
+    const unsigned __int128 a = lhs->value;
+    unsigned __int128 dropped = 0;
+    bool big = false;
+
+    if (b_scale > lhs->scale) {
+        // b = q * 10^d + dropped: only q reaches the scale of lhs, and dropped may pull the sum towards zero below
+        const uint64_t d = b_scale - lhs->scale;
+        const unsigned __int128 q = d > BSTD_WIDE_NUMBER_MAX_LENGTH ? 0 : bstd_div_pow10_u128(b, d);
+        dropped = b - (d > BSTD_WIDE_NUMBER_MAX_LENGTH ? 0 : q * bstd_pow10_u128(d));
+        b = q;
+    } else {
+        b = wide_rescale_magnitude(b, b_scale, lhs->scale, &big);
+    }
+
+    bool negative;
+    unsigned __int128 magnitude;
+
+    if (a_negative == b_negative) {
+        negative = a_negative;
+        magnitude = a + b;
+    } else if (big || b > a) {
+        // a b of 10^38 or more exceeds a; its magnitude is known modulo 10^38 only, which suffices for cropping
+        negative = b_negative;
+        magnitude = big ? b + bstd_pow10_u128(BSTD_WIDE_NUMBER_MAX_LENGTH) - a : b - a;
+    } else {
+        negative = a_negative;
+        magnitude = a - b;
+    }
+
+    if (dropped != 0 && magnitude != 0 && negative != b_negative) {
+        // the dropped digits have the opposite sign of the sum, so the truncated sum is one unit closer to zero
+        magnitude -= 1;
+    }
+
+    wide_store_magnitude(lhs, negative, magnitude);
+}
+
+/**
+ * Writes the decimal digits of the specified value to the specified buffer, most significant digit first.
+ * @param out The buffer to write to. Must hold at least the specified minimum number of digits, and no fewer than 39.
+ * @param value The value to write.
+ * @param min_digits The minimum number of digits to write; shorter values are padded with leading zeros.
+ * @return Returns the number of digits written.
+ */
+static size_t write_digits(char* out, unsigned __int128 value, size_t min_digits) {
+
+    char reversed[2 * BSTD_POW10_MAX_EXP + 1];
+    size_t n = 0;
+
+    do {
+        reversed[n++] = (char) ('0' + (int) (value % 10));
+        value /= 10;
+    } while (value);
+
+    while (n < min_digits) {
+        reversed[n++] = '0';
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = reversed[n - 1 - i];
+    }
+
+    return n;
+}
+
+void bstd_wide_assign(bstd_wide_number* assignee, const bstd_wide_number* value) {
+    wide_store_rescaled(assignee, wide_is_negative(value), value->value, value->scale);
+}
+
+void bstd_wide_assign_number(bstd_wide_number* assignee, const bstd_number* value) {
+    wide_store_rescaled(assignee, bstd_is_negative(value), value->value, value->scale);
+}
+
+void bstd_wide_assign_int64(bstd_wide_number* number, const int64_t value) {
+    wide_store_rescaled(number, value < 0, value < 0 ? -(uint64_t) value : (uint64_t) value, 0);
+}
+
+void bstd_assign_wide(bstd_number* assignee, const bstd_wide_number* value) {
+    bool big;
+    const __int128 magnitude = (__int128) wide_rescale_magnitude(value->value, value->scale, assignee->scale, &big);
+    bstd_store_scaled(assignee, wide_is_negative(value) ? -magnitude : magnitude);
+}
+
+void bstd_wide_add(bstd_wide_number *lhs, const bstd_wide_number *rhs) {
+    wide_add_magnitude(lhs, wide_is_negative(rhs), rhs->value, rhs->scale);
+}
+
+void bstd_wide_subtract(bstd_wide_number *lhs, const bstd_wide_number *rhs) {
+    wide_add_magnitude(lhs, !wide_is_negative(rhs) && rhs->value != 0, rhs->value, rhs->scale);
+}
+
+void bstd_wide_add_number(bstd_wide_number *lhs, const bstd_number *rhs) {
+    wide_add_magnitude(lhs, bstd_is_negative(rhs) && rhs->value != 0, rhs->value, rhs->scale);
+}
+
+void bstd_wide_subtract_number(bstd_wide_number *lhs, const bstd_number *rhs) {
+    wide_add_magnitude(lhs, !bstd_is_negative(rhs) && rhs->value != 0, rhs->value, rhs->scale);
+}
+
+int bstd_wide_compare(const bstd_wide_number* lhs, const bstd_wide_number* rhs) {
+
+    const bool lhs_negative = wide_is_negative(lhs);
+    const bool rhs_negative = wide_is_negative(rhs);
+
+    if (lhs_negative != rhs_negative) {
+        return lhs_negative ? -1 : 1;
+    }
+
+    const int order = bstd_compare_magnitudes(lhs->value, lhs->scale, rhs->value, rhs->scale);
+
+    return lhs_negative ? -order : order;
+}
+
+bool bstd_wide_greater_than(const bstd_wide_number* lhs, const bstd_wide_number* rhs) {
+    return bstd_wide_compare(lhs, rhs) > 0;
+}
+
+bool bstd_wide_less_than(const bstd_wide_number* lhs, const bstd_wide_number* rhs) {
+    return bstd_wide_compare(lhs, rhs) < 0;
+}
+
+bool bstd_wide_equals(const bstd_wide_number* lhs, const bstd_wide_number* rhs) {
+    return bstd_wide_compare(lhs, rhs) == 0;
+}
+
+char* bstd_wide_to_cstr(const bstd_wide_number* number) {
+    return bstd_wide_to_cstr_arena(NULL, number);
+}
+
+char* bstd_wide_to_cstr_arena(bstd_arena* arena, const bstd_wide_number* number) {
+
+    char* result = bstd_allocate(arena, sizeof(char) * WIDE_CSTR_MAX_LENGTH);
+    size_t n = 0;
+
+    if (wide_is_negative(number)) {
+        result[n++] = '-';
+    }
+
+    if (number->scale == 0) {
+        n += write_digits(result + n, number->value, 1);
+        result[n] = '\0';
+        return result;
+    }
+
+    // like printf("%0*.*f", length + 1, scale, value): zeros are padded between the sign and the integer part
+    const unsigned __int128 unit = bstd_pow10_u128(number->scale);
+    char integer[2 * BSTD_POW10_MAX_EXP + 1];
+    const size_t integer_digits = write_digits(integer, number->value / unit, 1);
+    const size_t width = (size_t) number->length + 1;
+    const size_t used = n + integer_digits + 1 + number->scale;
+
+    for (size_t i = used; i < width; ++i) {
+        result[n++] = '0';
+    }
+
+    for (size_t i = 0; i < integer_digits; ++i) {
+        result[n++] = integer[i];
+    }
+
+    result[n++] = '.';
+    n += write_digits(result + n, number->value % unit, number->scale);
+    result[n] = '\0';
+
+    return result;
+}
@@ -0,0 +1,84 @@
+#include <criterion/criterion.h>
+#include "../include/allocator.h"
+#include "../include/arena.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+#include "../include/picutils.h"
+
+/*
+ * bstd_set_allocator
+ */
+
+Test(allocator_tests, set_allocator__counts_allocations){
+
+    // given a counting allocator...
+    bstd_allocation_counter counter;
+    bstd_allocation_counter_init(&counter);
+    bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter);
+
+    // ... when we create and release objects, including pictures of masks that were never interned before...
+    bstd_number *a = bstd_number_from_int(12, 3, true);
+    bstd_number *b = bstd_number_from_int(5, 3, true);
+    bstd_number *sum = bstd_sum(a, b);
+    const size_t number_bytes = counter.bytes;
+    bstd_picture *picture = bstd_create_picture("9XA9X");
+    bstd_picture *other = bstd_create_picture("AX99");
+    bstd_assign_picture(picture, other);
+    bstd_free(a);
+    bstd_free(b);
+    bstd_free(sum);
+    bstd_free(picture);
+    bstd_free(other);
+
+    bstd_set_allocator(NULL, NULL, NULL, NULL);
+
+    // ... then every allocation must go through the hooks and be released, and every picture must be a single allocation;
+    // the interned masks and their move plan are kept by the library and not allocated with the hooks.
+    cr_assert_eq(counter.allocations, 5);
+    cr_assert_eq(counter.frees, 5);
+    cr_assert_eq(number_bytes, 3 * sizeof(bstd_number));
+    cr_assert_eq(counter.bytes, number_bytes + BSTD_PICTURE_SIZE(5) + BSTD_PICTURE_SIZE(4));
+}
+
+Test(allocator_tests, set_allocator__null_restores_default){
+
+    // given a counting allocator that was removed again...
+    bstd_allocation_counter counter;
+    bstd_allocation_counter_init(&counter);
+    bstd_set_allocator(bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter);
+    bstd_set_allocator(NULL, NULL, NULL, NULL);
+
+    // ... when we allocate...
+    bstd_number *number = bstd_number_from_int(1, 1, false);
+    bstd_free(number);
+
+    // ... then the counter must not be used.
+    cr_assert_eq(counter.allocations, 0);
+    cr_assert_eq(counter.frees, 0);
+}
+
+/*
+ * bstd_arena_init_with_allocator
+ */
+
+Test(allocator_tests, arena_init_with_allocator__chunks_use_allocator){
+
+    // given an arena with a counting allocator of its own...
+    bstd_allocation_counter counter;
+    bstd_allocation_counter_init(&counter);
+    const bstd_allocator allocator = { bstd_counting_alloc, bstd_counting_realloc, bstd_counting_free, &counter };
+    bstd_arena arena;
+    bstd_arena_init_with_allocator(&arena, 64, &allocator);
+
+    // ... when we allocate numbers from it and destroy it...
+    for (int i = 0; i < 8; ++i) {
+        bstd_number_from_int_arena(&arena, i, 2, false);
+    }
+    const size_t allocations = counter.allocations;
+    bstd_arena_destroy(&arena);
+
+    // ... then only its chunks must have been allocated, and all of them released.
+    cr_assert_lt(allocations, 8);
+    cr_assert_gt(allocations, 0);
+    cr_assert_eq(counter.frees, allocations);
+}
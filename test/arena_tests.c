@@ -0,0 +1,120 @@
+#include <criterion/criterion.h>
+#include <stdint.h>
+#include <string.h>
+#include "../include/arena.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+#include "../include/picutils.h"
+
+/*
+ * bstd_arena_alloc
+ */
+
+Test(arena_tests, arena_alloc__aligned){
+
+    // given an arena...
+    bstd_arena arena;
+    bstd_arena_init(&arena, 0);
+
+    // ... when we allocate odd sizes from it...
+    void *a = bstd_arena_alloc(&arena, 3);
+    void *b = bstd_arena_alloc(&arena, 5);
+
+    // ... then every allocation must be aligned and distinct.
+    cr_assert_eq((uintptr_t) a % 16, 0);
+    cr_assert_eq((uintptr_t) b % 16, 0);
+    cr_assert_neq(a, b);
+
+    bstd_arena_destroy(&arena);
+}
+
+Test(arena_tests, arena_alloc__grows){
+
+    // given an arena of small chunks...
+    bstd_arena arena;
+    bstd_arena_init(&arena, 64);
+
+    // ... when we allocate more than a single chunk holds, including a request larger than a chunk...
+    unsigned char *a = bstd_arena_alloc(&arena, 48);
+    unsigned char *b = bstd_arena_alloc(&arena, 48);
+    unsigned char *c = bstd_arena_alloc(&arena, 1000);
+    memset(a, 1, 48);
+    memset(b, 2, 48);
+    memset(c, 3, 1000);
+
+    // ... then the allocations must not overlap.
+    cr_assert_eq(a[47], 1);
+    cr_assert_eq(b[47], 2);
+    cr_assert_eq(c[999], 3);
+    cr_assert_neq(arena.head, arena.current);
+
+    bstd_arena_destroy(&arena);
+}
+
+/*
+ * bstd_arena_reset
+ */
+
+Test(arena_tests, arena_reset__reuses_chunks){
+
+    // given an arena that has grown to several chunks...
+    bstd_arena arena;
+    bstd_arena_init(&arena, 64);
+    void *first = bstd_arena_alloc(&arena, 48);
+    bstd_arena_alloc(&arena, 48);
+    bstd_arena_chunk *second = arena.current;
+
+    // ... when we reset it and allocate the same sizes again...
+    bstd_arena_reset(&arena);
+    void *again = bstd_arena_alloc(&arena, 48);
+    bstd_arena_alloc(&arena, 48);
+
+    // ... then the kept chunks must be reused in order.
+    cr_assert_eq(again, first);
+    cr_assert_eq(arena.current, second);
+
+    bstd_arena_destroy(&arena);
+    cr_assert_null(arena.head);
+}
+
+/*
+ * _arena variants
+ */
+
+Test(arena_tests, arena_variants__allocate_from_arena){
+
+    // given an arena...
+    bstd_arena arena;
+    bstd_arena_init(&arena, 0);
+
+    // ... when we create numbers, pictures and strings in it...
+    bstd_number *a = bstd_number_from_int_arena(&arena, 12, 3, true);
+    bstd_number *b = bstd_number_from_int_arena(&arena, -5, 3, true);
+    bstd_number *sum = bstd_sum_arena(&arena, a, b);
+    bstd_number *quotient = bstd_quotient_arena(&arena, a, sum);
+    bstd_picture *picture = bstd_create_picture_arena(&arena, "XX9");
+    bstd_assign_str(picture, "AB7");
+
+    // ... then they must behave as their heap-allocated counterparts.
+    cr_assert_eq(bstd_number_to_int(sum), 7);
+    cr_assert_eq(bstd_number_to_int(quotient), 1);
+    cr_assert_str_eq(bstd_number_to_cstr_arena(&arena, *sum), "7");
+    cr_assert_str_eq(bstd_picture_to_cstr_arena(&arena, picture), "AB7");
+    cr_assert_eq(arena.head, arena.current);
+
+    bstd_arena_destroy(&arena);
+}
+
+Test(arena_tests, quotient_arena__zero_divisor){
+
+    // given an arena and a zero divisor...
+    bstd_arena arena;
+    bstd_arena_init(&arena, 0);
+    bstd_number *a = bstd_number_from_int_arena(&arena, 12, 3, true);
+    bstd_number *zero = bstd_number_from_int_arena(&arena, 0, 3, true);
+
+    // ... when we divide by it, then no quotient must be created.
+    cr_assert_null(bstd_quotient_arena(&arena, a, zero));
+
+    bstd_arena_destroy(&arena);
+}
@@ -1,4 +1,5 @@
 #include <criterion/criterion.h>
+#include <stdlib.h>
 #include "../include/arithmetic.h"
 
 /**
@@ -2933,3 +2934,858 @@ Test(arithmetic_tests, bstd_subtract_negative){
     cr_assert_eq(ex.positive,   lhs.positive);
 
 }
+
+/**
+ * Tests for void bstd_multiply(bstd_number *lhs, const bstd_number *rhs)
+ * and bstd_number* bstd_product(const bstd_number *lhs, const bstd_number *rhs)
+ */
+
+/*
+ * testing multiplication of two fixed-point numbers
+ *
+ * in:
+ * lhs = 12.34 (length 4, scale 2)
+ * rhs = 2.5 (length 2, scale 1)
+ *
+ * expected:
+ * lhs = 30.85 (value 3085, scale 2)
+ */
+Test(arithmetic_tests, bstd_multiply__differing_scales){
+    bstd_number lhs;
+    lhs.value = 1234;
+    lhs.scale = 2;
+    lhs.length = 4;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 25;
+    rhs.scale = 1;
+    rhs.length = 2;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_multiply(&lhs, &rhs);
+
+    cr_assert_eq(3085, lhs.value);
+    cr_assert_eq(2, lhs.scale);
+    cr_assert_eq(4, lhs.length);
+    cr_assert_eq(true, lhs.positive);
+}
+
+/*
+ * testing that the product's sign follows the signs of both sides
+ *
+ * in:
+ * lhs = -1.5 (length 2, scale 1, signed)
+ * rhs = 3 (length 1, scale 0, signed)
+ *
+ * expected:
+ * lhs = -4.5
+ */
+Test(arithmetic_tests, bstd_multiply__signed_neg){
+    bstd_number lhs;
+    lhs.value = 15;
+    lhs.scale = 1;
+    lhs.length = 2;
+    lhs.isSigned = true;
+    lhs.positive = false;
+
+    bstd_number rhs;
+    rhs.value = 3;
+    rhs.scale = 0;
+    rhs.length = 1;
+    rhs.isSigned = true;
+    rhs.positive = true;
+
+    bstd_multiply(&lhs, &rhs);
+
+    cr_assert_eq(45, lhs.value);
+    cr_assert_eq(false, lhs.positive);
+}
+
+/*
+ * testing that the product is cropped to the length of the left-hand side
+ *
+ * in:
+ * lhs = 999 (length 3)
+ * rhs = 11 (length 2)
+ *
+ * expected:
+ * lhs = 989 (10989 cropped to three digits)
+ */
+Test(arithmetic_tests, bstd_multiply__crops_to_length){
+    bstd_number lhs;
+    lhs.value = 999;
+    lhs.scale = 0;
+    lhs.length = 3;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 11;
+    rhs.scale = 0;
+    rhs.length = 2;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_multiply(&lhs, &rhs);
+
+    cr_assert_eq(989, lhs.value);
+}
+
+/*
+ * testing an 18-digit multiplication, which is inexact through doubles
+ *
+ * in:
+ * lhs = 123456789012345.678 (length 18, scale 3)
+ * rhs = 3 (length 1)
+ *
+ * expected:
+ * lhs = 370370367037037.034
+ */
+Test(arithmetic_tests, bstd_multiply__eighteen_digits_exact){
+    bstd_number lhs;
+    lhs.value = 123456789012345678;
+    lhs.scale = 3;
+    lhs.length = 18;
+    lhs.isSigned = true;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 3;
+    rhs.scale = 0;
+    rhs.length = 1;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_multiply(&lhs, &rhs);
+
+    cr_assert_eq(370370367037037034, lhs.value);
+}
+
+/*
+ * testing that the product's scale is the sum of both scales
+ *
+ * in:
+ * lhs = 1.5 (length 2, scale 1)
+ * rhs = -0.25 (length 3, scale 2, signed)
+ *
+ * expected:
+ * res = -0.375 (value 375, scale 3, length 3)
+ */
+Test(arithmetic_tests, bstd_product__scale_sum){
+    bstd_number lhs;
+    lhs.value = 15;
+    lhs.scale = 1;
+    lhs.length = 2;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 25;
+    rhs.scale = 2;
+    rhs.length = 3;
+    rhs.isSigned = true;
+    rhs.positive = false;
+
+    bstd_number* res = bstd_product(&lhs, &rhs);
+
+    cr_assert_eq(375, res->value);
+    cr_assert_eq(3, res->scale);
+    cr_assert_eq(3, res->length);
+    cr_assert_eq(true, res->isSigned);
+    cr_assert_eq(false, res->positive);
+
+    free(res);
+}
+
+/**
+ * Tests for void bstd_divide(bstd_number *lhs, const bstd_number *rhs),
+ * void bstd_divide_remainder(bstd_number *quotient, bstd_number *remainder, const bstd_number *dividend, const bstd_number *divisor)
+ * and their prepared-divisor counterparts.
+ */
+
+/*
+ * testing division of numbers of differing scales
+ *
+ * in:
+ * lhs = 10.00 (length 4, scale 2)
+ * rhs = 0.3 (length 1, scale 1)
+ *
+ * expected:
+ * lhs = 33.33 (33.333... truncated to scale 2)
+ */
+Test(arithmetic_tests, bstd_divide__differing_scales){
+    bstd_number lhs;
+    lhs.value = 1000;
+    lhs.scale = 2;
+    lhs.length = 4;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 3;
+    rhs.scale = 1;
+    rhs.length = 1;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_divide(&lhs, &rhs);
+
+    cr_assert_eq(3333, lhs.value);
+    cr_assert_eq(2, lhs.scale);
+}
+
+/*
+ * testing that the quotient's sign follows the signs of both sides
+ *
+ * in:
+ * lhs = -7 (length 2, signed)
+ * rhs = 2 (length 1)
+ *
+ * expected:
+ * lhs = -3 (-3.5 truncated towards zero)
+ */
+Test(arithmetic_tests, bstd_divide__signed_neg){
+    bstd_number lhs;
+    lhs.value = 7;
+    lhs.scale = 0;
+    lhs.length = 2;
+    lhs.isSigned = true;
+    lhs.positive = false;
+
+    bstd_number rhs;
+    rhs.value = 2;
+    rhs.scale = 0;
+    rhs.length = 1;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_divide(&lhs, &rhs);
+
+    cr_assert_eq(3, lhs.value);
+    cr_assert_eq(false, lhs.positive);
+}
+
+/*
+ * testing that division by zero leaves the left-hand side unchanged
+ *
+ * in:
+ * lhs = 42 (length 2)
+ * rhs = 0 (length 1)
+ *
+ * expected:
+ * lhs = 42
+ */
+Test(arithmetic_tests, bstd_divide__by_zero){
+    bstd_number lhs;
+    lhs.value = 42;
+    lhs.scale = 0;
+    lhs.length = 2;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 0;
+    rhs.scale = 0;
+    rhs.length = 1;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_divide(&lhs, &rhs);
+
+    cr_assert_eq(42, lhs.value);
+    cr_assert_eq(NULL, bstd_quotient(&lhs, &rhs));
+}
+
+/*
+ * testing a quotient whose dividend must be scaled by more than 10^19, which does not fit 128 bits in a single step
+ *
+ * in:
+ * lhs = 9999999999999999999 (length 19)
+ * rhs = 0.0000000000000000007 (length 19, scale 19)
+ *
+ * expected:
+ * quotient = ...571428571428571428 (scale 19, cropped to 18 digits)
+ */
+Test(arithmetic_tests, bstd_quotient__scale_exceeds_pow10_max){
+    bstd_number lhs;
+    lhs.value = 9999999999999999999ULL;
+    lhs.scale = 0;
+    lhs.length = 19;
+    lhs.isSigned = false;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 7;
+    rhs.scale = 19;
+    rhs.length = 19;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_number *quotient = bstd_quotient(&lhs, &rhs);
+
+    cr_assert_eq(571428571428571428ULL, quotient->value);
+    cr_assert_eq(19, quotient->scale);
+    cr_assert_eq(18, quotient->length);
+
+    free(quotient);
+}
+
+/*
+ * testing the remainder of a division with differing scales
+ *
+ * in:
+ * dividend = -10.5 (length 3, scale 1, signed)
+ * divisor = 4 (length 1)
+ * quotient: length 2, scale 0, signed
+ * remainder: length 3, scale 1, signed
+ *
+ * expected:
+ * quotient = -2 (-2.625 truncated)
+ * remainder = -2.5 (-10.5 - (-2 * 4))
+ */
+Test(arithmetic_tests, bstd_divide_remainder__differing_scales){
+    bstd_number dividend;
+    dividend.value = 105;
+    dividend.scale = 1;
+    dividend.length = 3;
+    dividend.isSigned = true;
+    dividend.positive = false;
+
+    bstd_number divisor;
+    divisor.value = 4;
+    divisor.scale = 0;
+    divisor.length = 1;
+    divisor.isSigned = false;
+    divisor.positive = true;
+
+    bstd_number quotient;
+    quotient.value = 0;
+    quotient.scale = 0;
+    quotient.length = 2;
+    quotient.isSigned = true;
+    quotient.positive = true;
+
+    bstd_number remainder;
+    remainder.value = 0;
+    remainder.scale = 1;
+    remainder.length = 3;
+    remainder.isSigned = true;
+    remainder.positive = true;
+
+    bstd_divide_remainder(&quotient, &remainder, &dividend, &divisor);
+
+    cr_assert_eq(2, quotient.value);
+    cr_assert_eq(false, quotient.positive);
+    cr_assert_eq(25, remainder.value);
+    cr_assert_eq(false, remainder.positive);
+}
+
+/*
+ * testing a quotient that does not fit its length, whose product with a high-scale divisor exceeds 128 bits
+ *
+ * in:
+ * dividend = 1234567890123456789 (length 19)
+ * divisor = 0.9999999999999999999 (length 19, scale 19)
+ * quotient: length 18, scale 18
+ * remainder = 42 (length 2)
+ *
+ * expected:
+ * quotient = ...123456789012345678 (scale 18, cropped to 18 digits)
+ * remainder = 42 (size error: left unchanged)
+ */
+Test(arithmetic_tests, bstd_divide_remainder__quotient_size_error){
+    bstd_number dividend;
+    dividend.value = 1234567890123456789ULL;
+    dividend.scale = 0;
+    dividend.length = 19;
+    dividend.isSigned = false;
+    dividend.positive = true;
+
+    bstd_number divisor;
+    divisor.value = 9999999999999999999ULL;
+    divisor.scale = 19;
+    divisor.length = 19;
+    divisor.isSigned = false;
+    divisor.positive = true;
+
+    bstd_number quotient;
+    quotient.value = 0;
+    quotient.scale = 18;
+    quotient.length = 18;
+    quotient.isSigned = false;
+    quotient.positive = true;
+
+    bstd_number remainder;
+    remainder.value = 42;
+    remainder.scale = 0;
+    remainder.length = 2;
+    remainder.isSigned = false;
+    remainder.positive = true;
+
+    bstd_divide_remainder(&quotient, &remainder, &dividend, &divisor);
+
+    cr_assert_eq(123456789012345678ULL, quotient.value);
+    cr_assert_eq(42, remainder.value);
+}
+
+/*
+ * testing that a prepared divisor gives the same results as plain division
+ *
+ * in:
+ * dividend = 1234567.89 (length 9, scale 2)
+ * divisor = 12 (length 2)
+ * quotient: length 9, scale 2
+ * remainder: length 9, scale 2
+ *
+ * expected:
+ * quotient = 102880.65
+ * remainder = 0.09
+ */
+Test(arithmetic_tests, bstd_divide_remainder_by__matches_divide_remainder){
+    bstd_number dividend;
+    dividend.value = 123456789;
+    dividend.scale = 2;
+    dividend.length = 9;
+    dividend.isSigned = false;
+    dividend.positive = true;
+
+    bstd_number divisor;
+    divisor.value = 12;
+    divisor.scale = 0;
+    divisor.length = 2;
+    divisor.isSigned = false;
+    divisor.positive = true;
+
+    bstd_number quotient;
+    quotient.value = 0;
+    quotient.scale = 2;
+    quotient.length = 9;
+    quotient.isSigned = false;
+    quotient.positive = true;
+
+    bstd_number remainder = quotient;
+
+    bstd_divisor prepared;
+    bstd_divisor_init(&prepared, &divisor);
+    bstd_divide_remainder_by(&quotient, &remainder, &dividend, &prepared);
+
+    cr_assert_eq(10288065, quotient.value);
+    cr_assert_eq(9, remainder.value);
+}
+
+/**
+ * Tests for void bstd_add_n(bstd_number *lhs, const bstd_number *rhs, size_t n)
+ * and void bstd_add_scalar_n(bstd_number *lhs, const bstd_number *rhs, size_t n)
+ */
+
+/*
+ * testing that batch sums are cropped to the shared length
+ *
+ * in:
+ * lhs = { 95, -95, 10 } (length 2, signed)
+ * rhs = { 7, -7, -15 } (length 2, signed)
+ *
+ * expected:
+ * lhs = { 2, -2, -5 } (102, -102 and -5 cropped to two digits)
+ */
+Test(arithmetic_tests, bstd_add_n__crops_to_length){
+    bstd_number lhs[3];
+    bstd_number rhs[3];
+    const uint64_t lhs_values[3] = { 95, 95, 10 };
+    const bool lhs_positive[3] = { true, false, true };
+    const uint64_t rhs_values[3] = { 7, 7, 15 };
+    const bool rhs_positive[3] = { true, false, false };
+
+    for (int i = 0; i < 3; i++) {
+        lhs[i].value = lhs_values[i];
+        lhs[i].scale = 0;
+        lhs[i].length = 2;
+        lhs[i].isSigned = true;
+        lhs[i].positive = lhs_positive[i];
+
+        rhs[i].value = rhs_values[i];
+        rhs[i].scale = 0;
+        rhs[i].length = 2;
+        rhs[i].isSigned = true;
+        rhs[i].positive = rhs_positive[i];
+    }
+
+    bstd_add_n(lhs, rhs, 3);
+
+    cr_assert_eq(2, lhs[0].value);
+    cr_assert_eq(true, lhs[0].positive);
+    cr_assert_eq(2, lhs[1].value);
+    cr_assert_eq(false, lhs[1].positive);
+    cr_assert_eq(5, lhs[2].value);
+    cr_assert_eq(false, lhs[2].positive);
+}
+
+/*
+ * testing that a batch of left-hand sides of mixed lengths is cropped to the length of every element
+ *
+ * in:
+ * lhs = { 95 (length 2), 95 (length 3), 95 (length 2, signed) }
+ * rhs = { 7, 7, -100 (length 3) }
+ *
+ * expected:
+ * lhs = { 2, 102, -5 }
+ */
+Test(arithmetic_tests, bstd_add_n__mixed_constraints){
+    bstd_number lhs[3];
+    bstd_number rhs[3];
+    const uint8_t lhs_lengths[3] = { 2, 3, 2 };
+    const bool lhs_signed[3] = { false, false, true };
+    const uint64_t rhs_values[3] = { 7, 7, 100 };
+    const uint8_t rhs_lengths[3] = { 1, 1, 3 };
+
+    for (int i = 0; i < 3; i++) {
+        lhs[i].value = 95;
+        lhs[i].scale = 0;
+        lhs[i].length = lhs_lengths[i];
+        lhs[i].isSigned = lhs_signed[i];
+        lhs[i].positive = true;
+
+        rhs[i].value = rhs_values[i];
+        rhs[i].scale = 0;
+        rhs[i].length = rhs_lengths[i];
+        rhs[i].isSigned = true;
+        rhs[i].positive = i < 2;
+    }
+
+    bstd_add_n(lhs, rhs, 3);
+
+    cr_assert_eq(2, lhs[0].value);
+    cr_assert_eq(102, lhs[1].value);
+    cr_assert_eq(5, lhs[2].value);
+    cr_assert_eq(false, lhs[2].positive);
+}
+
+/*
+ * testing that a batch of unsigned numbers drops the sign of negative results
+ *
+ * in:
+ * lhs = { 3, 8 } (length 1, unsigned)
+ * rhs = -5 (length 1, signed)
+ *
+ * expected:
+ * lhs = { 2, 3 }
+ */
+Test(arithmetic_tests, bstd_add_scalar_n__unsigned){
+    bstd_number lhs[2];
+    lhs[0].value = 3;
+    lhs[1].value = 8;
+    for (int i = 0; i < 2; i++) {
+        lhs[i].scale = 0;
+        lhs[i].length = 1;
+        lhs[i].isSigned = false;
+        lhs[i].positive = true;
+    }
+
+    bstd_number rhs;
+    rhs.value = 5;
+    rhs.scale = 0;
+    rhs.length = 1;
+    rhs.isSigned = true;
+    rhs.positive = false;
+
+    bstd_add_scalar_n(lhs, &rhs, 2);
+
+    cr_assert_eq(2, lhs[0].value);
+    cr_assert_eq(true, lhs[0].positive);
+    cr_assert_eq(3, lhs[1].value);
+}
+
+/*
+ * testing that an accumulator matches a sequence of bstd_add and bstd_subtract calls, including the truncation of
+ * fractions beyond the target's scale on every step
+ *
+ * in:
+ * total = 1 (length 9, scale 0, signed)
+ * rhs = -0.5, 2.75, -3.25, 0.5, ... (scale 2)
+ *
+ * expected:
+ * total as after the equivalent bstd_add/bstd_subtract sequence
+ */
+Test(arithmetic_tests, bstd_accumulator__matches_add_sequence){
+    bstd_number total;
+    total.value = 1;
+    total.scale = 0;
+    total.length = 9;
+    total.isSigned = true;
+    total.positive = true;
+
+    bstd_number expected = total;
+    bstd_accumulator accumulator;
+    bstd_accumulator_init(&accumulator, &total);
+
+    for (int i = 0; i < 1000; i++) {
+        bstd_number rhs;
+        rhs.value = (uint64_t) ((i * 37) % 400);
+        rhs.scale = 2;
+        rhs.length = 3;
+        rhs.isSigned = true;
+        rhs.positive = i % 3 != 0;
+
+        if (i % 5 == 0) {
+            bstd_subtract(&expected, &rhs);
+            bstd_accumulator_subtract(&accumulator, &rhs);
+        } else if (i % 7 == 0) {
+            bstd_add_int(&expected, i);
+            bstd_accumulator_add_int64(&accumulator, i);
+        } else if (i % 11 == 0) {
+            bstd_subtract_int(&expected, i);
+            bstd_accumulator_subtract_int64(&accumulator, i);
+        } else {
+            bstd_add(&expected, &rhs);
+            bstd_accumulator_add(&accumulator, &rhs);
+        }
+    }
+
+    bstd_accumulator_store(&accumulator, &total);
+
+    cr_assert_eq(expected.value, total.value);
+    cr_assert_eq(expected.positive, total.positive);
+}
+
+/*
+ * testing that an accumulator of an unsigned target drops the sign after every step, as bstd_add does
+ *
+ * in:
+ * total = 5 (length 3, unsigned)
+ * rhs = -10, then 3
+ *
+ * expected:
+ * total = 8 (|5 - 10| + 3), not 2
+ */
+Test(arithmetic_tests, bstd_accumulator__unsigned_drops_sign_per_step){
+    bstd_number total;
+    total.value = 5;
+    total.scale = 0;
+    total.length = 3;
+    total.isSigned = false;
+    total.positive = true;
+
+    bstd_number minus_ten;
+    minus_ten.value = 10;
+    minus_ten.scale = 0;
+    minus_ten.length = 2;
+    minus_ten.isSigned = true;
+    minus_ten.positive = false;
+
+    bstd_number expected = total;
+    bstd_accumulator accumulator;
+    bstd_accumulator_init(&accumulator, &total);
+
+    bstd_add(&expected, &minus_ten);
+    bstd_add_int(&expected, 3);
+    bstd_accumulator_add(&accumulator, &minus_ten);
+    bstd_accumulator_add_int64(&accumulator, 3);
+    bstd_accumulator_store(&accumulator, &total);
+
+    cr_assert_eq(8, expected.value);
+    cr_assert_eq(expected.value, total.value);
+
+    // 2 - 5 - 5 is |2 - 5| - 5 = -2, stored as 2
+    total.value = 2;
+    expected = total;
+    bstd_accumulator_init(&accumulator, &total);
+
+    bstd_subtract_int(&expected, 5);
+    bstd_subtract_int(&expected, 5);
+    bstd_accumulator_subtract_int64(&accumulator, 5);
+    bstd_accumulator_subtract_int64(&accumulator, 5);
+    bstd_accumulator_store(&accumulator, &total);
+
+    cr_assert_eq(2, expected.value);
+    cr_assert_eq(expected.value, total.value);
+}
+
+/*
+ * testing that an accumulator of an unsigned target matches a sequence of bstd_add and bstd_subtract calls
+ *
+ * in:
+ * total = 1 (length 9, scale 0, unsigned)
+ * rhs = -0.5, 2.75, -3.25, 0.5, ... (scale 2)
+ *
+ * expected:
+ * total as after the equivalent bstd_add/bstd_subtract sequence
+ */
+Test(arithmetic_tests, bstd_accumulator__unsigned_matches_add_sequence){
+    bstd_number total;
+    total.value = 1;
+    total.scale = 0;
+    total.length = 9;
+    total.isSigned = false;
+    total.positive = true;
+
+    bstd_number expected = total;
+    bstd_accumulator accumulator;
+    bstd_accumulator_init(&accumulator, &total);
+
+    for (int i = 0; i < 1000; i++) {
+        bstd_number rhs;
+        rhs.value = (uint64_t) ((i * 37) % 400);
+        rhs.scale = 2;
+        rhs.length = 3;
+        rhs.isSigned = true;
+        rhs.positive = i % 3 == 0;
+
+        if (i % 5 == 0) {
+            bstd_subtract(&expected, &rhs);
+            bstd_accumulator_subtract(&accumulator, &rhs);
+        } else if (i % 7 == 0) {
+            bstd_subtract_int(&expected, i);
+            bstd_accumulator_subtract_int64(&accumulator, i);
+        } else {
+            bstd_add(&expected, &rhs);
+            bstd_accumulator_add(&accumulator, &rhs);
+        }
+    }
+
+    bstd_accumulator_store(&accumulator, &total);
+
+    cr_assert_eq(expected.value, total.value);
+    cr_assert_eq(true, total.positive);
+}
+
+/*
+ * testing that an accumulator at a larger scale than its operands adds exactly, and crops only on store
+ *
+ * in:
+ * total = 0.00 (length 3, scale 2, unsigned)
+ * rhs = 1.5 (scale 1), added 1000 times
+ *
+ * expected:
+ * total = 1500.00 cropped to 3 digits, i.e. 0.00
+ */
+Test(arithmetic_tests, bstd_accumulator__crops_on_store){
+    bstd_number total;
+    total.value = 0;
+    total.scale = 2;
+    total.length = 3;
+    total.isSigned = false;
+    total.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 15;
+    rhs.scale = 1;
+    rhs.length = 2;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    bstd_accumulator accumulator;
+    bstd_accumulator_init(&accumulator, &total);
+
+    for (int i = 0; i < 1000; i++) {
+        bstd_accumulator_add(&accumulator, &rhs);
+    }
+
+    cr_assert(accumulator.sum == 150000);
+
+    bstd_accumulator_store(&accumulator, &total);
+
+    cr_assert_eq(0, total.value);
+    cr_assert_eq(true, total.positive);
+}
+
+/*
+ * testing that checked additions and subtractions agree with bstd_add and bstd_subtract whenever no size error occurs,
+ * and leave the left-hand side unchanged when one does
+ *
+ * in:
+ * lhs, rhs from a grid of values, scales and signs (lhs length 4)
+ *
+ * expected:
+ * a size error iff the truncated integer digits of the result do not fit 4 digits
+ */
+Test(arithmetic_tests, bstd_add_checked__matches_add){
+    const uint64_t values[] = { 0, 1, 5, 999, 5000, 9999 };
+    const uint64_t scales[] = { 0, 1, 3 };
+
+    for (int i = 0; i < 36; i++) {
+        for (int j = 0; j < 36; j++) {
+            for (int subtract = 0; subtract < 2; subtract++) {
+                bstd_number lhs;
+                lhs.value = values[i % 6];
+                lhs.scale = scales[(i / 6) % 3];
+                lhs.length = 4;
+                lhs.isSigned = i % 2 == 0;
+                lhs.positive = i % 4 < 2;
+
+                bstd_number rhs;
+                rhs.value = values[j % 6];
+                rhs.scale = scales[(j / 6) % 3];
+                rhs.length = 4;
+                rhs.isSigned = true;
+                rhs.positive = j % 3 != 0;
+
+                bstd_number expected = lhs;
+                bstd_number checked = lhs;
+                bool ok;
+
+                if (subtract) {
+                    bstd_subtract(&expected, &rhs);
+                    ok = bstd_subtract_checked(&checked, &rhs);
+                } else {
+                    bstd_add(&expected, &rhs);
+                    ok = bstd_add_checked(&checked, &rhs);
+                }
+
+                // the exact result at the scale of lhs, computed independently
+                const int64_t unit_l = ipow(10, lhs.scale);
+                const int64_t unit_r = ipow(10, rhs.scale);
+                const int64_t l = (lhs.isSigned && !lhs.positive ? -1 : 1) * (int64_t) lhs.value * unit_r;
+                const int64_t r = (rhs.positive ? 1 : -1) * (int64_t) rhs.value * unit_l * (subtract ? -1 : 1);
+                const int64_t exact = (l + r) / unit_r;
+
+                cr_assert_eq(ok, llabs(exact) < 10000);
+
+                if (ok) {
+                    cr_assert_eq(checked.value, expected.value);
+                    cr_assert_eq(checked.positive, expected.positive);
+                } else {
+                    cr_assert_eq(checked.value, lhs.value);
+                    cr_assert_eq(checked.positive, lhs.positive);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * testing the size error of a checked multiplication
+ *
+ * in:
+ * lhs = 50.00 (length 4, scale 2)
+ * rhs = 1.99, then 2
+ *
+ * expected:
+ * 99.50 without a size error, then a size error for 199.00
+ */
+Test(arithmetic_tests, bstd_multiply_checked__size_error){
+    bstd_number lhs;
+    lhs.value = 5000;
+    lhs.scale = 2;
+    lhs.length = 4;
+    lhs.isSigned = true;
+    lhs.positive = true;
+
+    bstd_number rhs;
+    rhs.value = 199;
+    rhs.scale = 2;
+    rhs.length = 3;
+    rhs.isSigned = false;
+    rhs.positive = true;
+
+    cr_assert_eq(true, bstd_multiply_checked(&lhs, &rhs));
+    cr_assert_eq(9950, lhs.value);
+
+    rhs.value = 2;
+    rhs.scale = 0;
+
+    cr_assert_eq(false, bstd_multiply_checked(&lhs, &rhs));
+    cr_assert_eq(9950, lhs.value);
+}
@@ -0,0 +1,169 @@
+#include <criterion/criterion.h>
+#include <stdlib.h>
+#include "../include/columnutils.h"
+#include "../include/arithmetic.h"
+#include "../include/numutils.h"
+
+/*
+ * bstd_create_number_column
+ */
+
+Test(columnutils_tests, create_number_column__zeroed){
+
+    // given a new column...
+    bstd_number_column* column = bstd_create_number_column(4, 9, 2, true);
+
+    // ... then every element must hold zero under the column's constraints.
+    for (size_t i = 0; i < column->size; i++) {
+        bstd_number element;
+        bstd_number_column_get(column, i, &element);
+
+        cr_assert_eq(element.value, 0);
+        cr_assert_eq(element.scale, 2);
+        cr_assert_eq(element.length, 9);
+        cr_assert_eq(element.isSigned, true);
+        cr_assert_eq(element.positive, true);
+    }
+
+    free(column);
+}
+
+Test(columnutils_tests, create_number_column__length_beyond_eighteen){
+
+    // given a length the 64-bit elements cannot hold...
+    // ... when we create a column of that length...
+    bstd_number_column* column = bstd_create_number_column(4, 19, 0, false);
+
+    // ... then no column must be created.
+    cr_assert_null(column);
+}
+
+/*
+ * bstd_number_column_set
+ */
+
+Test(columnutils_tests, number_column_set__follows_assignment){
+
+    // given a PIC S9(3)V99 column...
+    bstd_number_column* column = bstd_create_number_column(1, 5, 2, true);
+
+    // ... when we set an element to a number of different constraints...
+    bstd_number value;
+    value.isSigned = true;
+    value.length = 7;
+    value.scale = 3;
+    value.positive = false;
+    value.value = 1234567;
+
+    bstd_number_column_set(column, 0, &value);
+
+    // ... then the element must be truncated and cropped as by bstd_assign_number.
+    bstd_number expected;
+    expected.isSigned = true;
+    expected.length = 5;
+    expected.scale = 2;
+    expected.positive = true;
+    expected.value = 0;
+    bstd_assign_number(&expected, &value);
+
+    bstd_number element;
+    bstd_number_column_get(column, 0, &element);
+
+    cr_assert_eq(element.value, expected.value);
+    cr_assert_eq(element.positive, expected.positive);
+
+    free(column);
+}
+
+/*
+ * bstd_number_column_for_each
+ */
+
+static void aux_sum_elements(const bstd_number* element, size_t index, void* context) {
+    (void) index;
+    *(int64_t*) context += bstd_number_to_int(element);
+}
+
+Test(columnutils_tests, number_column_for_each__visits_all){
+
+    // given a column of integers...
+    bstd_number_column* column = bstd_create_number_column(3, 3, 0, true);
+    column->values[0] = 5;
+    column->values[1] = -7;
+    column->values[2] = 100;
+
+    // ... when we iterate over it...
+    int64_t sum = 0;
+    bstd_number_column_for_each(column, aux_sum_elements, &sum);
+
+    // ... then every element must have been visited.
+    cr_assert_eq(sum, 98);
+
+    free(column);
+}
+
+/*
+ * bstd_number_column_add
+ */
+
+Test(columnutils_tests, number_column_add__matches_bstd_add){
+
+    // given two columns of the same constraints...
+    bstd_number_column* lhs = bstd_create_number_column(5, 2, 1, true);
+    bstd_number_column* rhs = bstd_create_number_column(5, 2, 1, true);
+    const int64_t a[5] = { 95, -95, 10, 0, 99 };
+    const int64_t b[5] = { 7, -7, -15, -3, 99 };
+
+    for (size_t i = 0; i < 5; i++) {
+        lhs->values[i] = a[i];
+        rhs->values[i] = b[i];
+    }
+
+    // ... when we add them...
+    bstd_number_column_add(lhs, rhs);
+
+    // ... then every element must equal the result of bstd_add.
+    for (size_t i = 0; i < 5; i++) {
+        bstd_number expected;
+        bstd_number addend;
+        bstd_number element;
+        expected = (bstd_number) { .value = (uint64_t) llabs(a[i]), .scale = 1, .length = 2, .isSigned = true, .positive = a[i] >= 0 };
+        addend = (bstd_number) { .value = (uint64_t) llabs(b[i]), .scale = 1, .length = 2, .isSigned = true, .positive = b[i] >= 0 };
+        bstd_add(&expected, &addend);
+        bstd_number_column_get(lhs, i, &element);
+
+        cr_assert_eq(element.value, expected.value);
+        cr_assert_eq(element.positive, expected.positive);
+    }
+
+    free(lhs);
+    free(rhs);
+}
+
+/*
+ * bstd_number_column_add_number
+ */
+
+Test(columnutils_tests, number_column_add_number__differing_scale){
+
+    // given a PIC 9(3)V9 column...
+    bstd_number_column* column = bstd_create_number_column(2, 4, 1, false);
+    column->values[0] = 10;
+    column->values[1] = 9999;
+
+    // ... when we add a number of a finer scale...
+    bstd_number value;
+    value.isSigned = false;
+    value.length = 3;
+    value.scale = 2;
+    value.positive = true;
+    value.value = 155;
+
+    bstd_number_column_add_number(column, &value);
+
+    // ... then the sums must be truncated to the column's scale and cropped to its length.
+    cr_assert_eq(column->values[0], 25);
+    cr_assert_eq(column->values[1], 14);
+
+    free(column);
+}
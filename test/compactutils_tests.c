@@ -0,0 +1,157 @@
+#include <criterion/criterion.h>
+#include "../include/compactutils.h"
+#include "../include/arithmetic.h"
+
+static bstd_number make_number(uint64_t value, uint64_t scale, uint8_t length, bool isSigned, bool positive) {
+    bstd_number number;
+    number.value = value;
+    number.scale = scale;
+    number.length = length;
+    number.isSigned = isSigned;
+    number.positive = positive;
+    return number;
+}
+
+/*
+ * bstd_compact_number
+ */
+
+Test(compactutils_tests, compact_number__size){
+    cr_assert_eq(sizeof(bstd_compact_number), 16);
+}
+
+/*
+ * bstd_compact_from_number / bstd_compact_to_number
+ */
+
+Test(compactutils_tests, compact_from_number__negative){
+
+    // given a negative number...
+    bstd_number number = make_number(5555, 3, 5, true, false);
+
+    // ... when we compact it...
+    bstd_compact_number compact;
+    bstd_compact_from_number(&compact, &number);
+
+    // ... then its value must be held in two's complement.
+    cr_assert_eq(compact.value, -5555);
+    cr_assert_eq(compact.scale, 3);
+    cr_assert_eq(compact.length, 5);
+    cr_assert_eq(compact.flags, BSTD_COMPACT_SIGNED);
+}
+
+Test(compactutils_tests, compact_from_number__unsigned_drops_sign){
+
+    // given an unsigned number with a negative flag...
+    bstd_number number = make_number(42, 0, 2, false, false);
+
+    // ... when we compact it...
+    bstd_compact_number compact;
+    bstd_compact_from_number(&compact, &number);
+
+    // ... then the flag must be ignored.
+    cr_assert_eq(compact.value, 42);
+    cr_assert_eq(compact.flags, 0);
+}
+
+Test(compactutils_tests, compact_to_number__round_trip){
+
+    // given a compacted negative number...
+    bstd_number number = make_number(123456, 2, 8, true, false);
+    bstd_compact_number compact;
+    bstd_compact_from_number(&compact, &number);
+
+    // ... when we expand it again...
+    bstd_number result;
+    bstd_compact_to_number(&result, &compact);
+
+    // ... then the original number must be restored.
+    cr_assert_eq(result.value, 123456);
+    cr_assert_eq(result.scale, 2);
+    cr_assert_eq(result.length, 8);
+    cr_assert_eq(result.isSigned, true);
+    cr_assert_eq(result.positive, false);
+}
+
+/*
+ * bstd_compact_assign
+ */
+
+Test(compactutils_tests, compact_assign__crops_and_truncates){
+
+    // given a PIC 9(3)V9 compact number and a negative value of higher precision...
+    bstd_number number = make_number(123456, 2, 8, true, false);
+    bstd_compact_number value;
+    bstd_compact_from_number(&value, &number);
+    bstd_compact_number assignee = { 0, 1, 4, 0 };
+
+    // ... when we assign the value...
+    bstd_compact_assign(&assignee, &value);
+
+    // ... then it must be truncated, cropped and lose its sign.
+    cr_assert_eq(assignee.value, 2345);
+}
+
+/*
+ * bstd_compact_add / bstd_compact_subtract
+ */
+
+Test(compactutils_tests, compact_add__matches_bstd_add){
+
+    const uint64_t values[] = { 0, 1, 9, 99, 12345, 999999, 100000000000000000ULL };
+    const uint64_t scales[] = { 0, 2, 5 };
+    const size_t n_values = sizeof(values) / sizeof(values[0]);
+    const size_t n_scales = sizeof(scales) / sizeof(scales[0]);
+
+    for (size_t i = 0; i < n_values * n_scales * 2; i++) {
+        for (size_t j = 0; j < n_values * n_scales * 2; j++) {
+
+            // given two numbers...
+            bstd_number a = make_number(values[i % n_values], scales[(i / n_values) % n_scales], 18, true, i % 2 == 0);
+            bstd_number b = make_number(values[j % n_values], scales[(j / n_values) % n_scales], 18, true, j % 2 == 0);
+            bstd_compact_number ca;
+            bstd_compact_number cb;
+            bstd_compact_from_number(&ca, &a);
+            bstd_compact_from_number(&cb, &b);
+            bstd_number sum = a;
+            bstd_number difference = a;
+            bstd_compact_number compact_sum = ca;
+            bstd_compact_number compact_difference = ca;
+
+            // ... when we add and subtract them in both representations...
+            bstd_add(&sum, &b);
+            bstd_subtract(&difference, &b);
+            bstd_compact_add(&compact_sum, &cb);
+            bstd_compact_subtract(&compact_difference, &cb);
+
+            // ... then the results must agree.
+            bstd_number result;
+            bstd_compact_to_number(&result, &compact_sum);
+            cr_assert_eq(result.value, sum.value);
+            cr_assert_eq(result.positive, sum.positive);
+            bstd_compact_to_number(&result, &compact_difference);
+            cr_assert_eq(result.value, difference.value);
+            cr_assert_eq(result.positive, difference.positive);
+        }
+    }
+}
+
+/*
+ * bstd_compact_compare
+ */
+
+Test(compactutils_tests, compact_compare__different_scales){
+
+    // given 1.5, -1.5 and 1.50...
+    bstd_compact_number a = { 15, 1, 2, BSTD_COMPACT_SIGNED };
+    bstd_compact_number b = { -15, 1, 2, BSTD_COMPACT_SIGNED };
+    bstd_compact_number c = { 150, 2, 3, BSTD_COMPACT_SIGNED };
+    bstd_compact_number d = { -151, 2, 3, BSTD_COMPACT_SIGNED };
+
+    // ... then they must compare by value.
+    cr_assert_eq(bstd_compact_compare(&a, &c), 0);
+    cr_assert_eq(bstd_compact_compare(&b, &a), -1);
+    cr_assert_eq(bstd_compact_compare(&a, &b), 1);
+    cr_assert_eq(bstd_compact_compare(&d, &b), -1);
+    cr_assert_eq(bstd_compact_compare(&b, &d), 1);
+}
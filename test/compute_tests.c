@@ -0,0 +1,214 @@
+#include <criterion/criterion.h>
+#include <stdlib.h>
+#include "../include/compute.h"
+#include "../include/arithmetic.h"
+
+static bstd_number make_number(uint64_t value, uint64_t scale, uint8_t length, bool isSigned, bool positive) {
+    bstd_number number;
+    number.value = value;
+    number.scale = scale;
+    number.length = length;
+    number.isSigned = isSigned;
+    number.positive = positive;
+    return number;
+}
+
+/*
+ * bstd_compute_compile
+ */
+
+Test(compute_tests, compute_compile__postfix){
+
+    // given the tree for (A + B) * C - D / E...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression b = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression c = { BSTD_EXPRESSION_OPERAND, 2, NULL, NULL };
+    const bstd_expression d = { BSTD_EXPRESSION_OPERAND, 3, NULL, NULL };
+    const bstd_expression e = { BSTD_EXPRESSION_OPERAND, 4, NULL, NULL };
+    const bstd_expression sum = { BSTD_EXPRESSION_ADD, 0, &a, &b };
+    const bstd_expression product = { BSTD_EXPRESSION_MULTIPLY, 0, &sum, &c };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &d, &e };
+    const bstd_expression root = { BSTD_EXPRESSION_SUBTRACT, 0, &product, &quotient };
+
+    // ... when we compile it...
+    bstd_program *program = bstd_compute_compile(&root);
+
+    // ... then it must be emitted in postfix order: A B + C * D E / -
+    const uint8_t opcodes[] = {
+            BSTD_EXPRESSION_OPERAND, BSTD_EXPRESSION_OPERAND, BSTD_EXPRESSION_ADD, BSTD_EXPRESSION_OPERAND,
+            BSTD_EXPRESSION_MULTIPLY, BSTD_EXPRESSION_OPERAND, BSTD_EXPRESSION_OPERAND, BSTD_EXPRESSION_DIVIDE,
+            BSTD_EXPRESSION_SUBTRACT
+    };
+    cr_assert_eq(program->size, 9);
+    cr_assert_eq(program->operands, 5);
+    for (size_t i = 0; i < program->size; i++) {
+        cr_assert_eq(program->code[i].opcode, opcodes[i]);
+    }
+    cr_assert_eq(program->code[6].operand, 4);
+
+    free(program);
+}
+
+Test(compute_tests, compute_compile__malformed){
+
+    // given a tree missing a child...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression sum = { BSTD_EXPRESSION_ADD, 0, &a, NULL };
+
+    // ... then it must not compile.
+    cr_assert_null(bstd_compute_compile(&sum));
+    cr_assert_null(bstd_compute_compile(NULL));
+}
+
+Test(compute_tests, compute_compile__too_deep){
+
+    // given a right-leaning chain A + (A + (A + ...)) deeper than the evaluation stack...
+    bstd_expression nodes[BSTD_COMPUTE_MAX_DEPTH + 1];
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    nodes[0] = a;
+    for (int i = 1; i <= BSTD_COMPUTE_MAX_DEPTH; i++) {
+        const bstd_expression sum = { BSTD_EXPRESSION_ADD, 0, &a, &nodes[i - 1] };
+        nodes[i] = sum;
+    }
+
+    // ... then it must not compile, while a chain that fits the stack must.
+    cr_assert_null(bstd_compute_compile(&nodes[BSTD_COMPUTE_MAX_DEPTH]));
+
+    bstd_program *program = bstd_compute_compile(&nodes[BSTD_COMPUTE_MAX_DEPTH - 1]);
+    cr_assert_not_null(program);
+    free(program);
+}
+
+/*
+ * bstd_compute
+ */
+
+Test(compute_tests, compute__exact_intermediates){
+
+    // given COMPUTE X = (A + B) * C - D / E, with X PICTURE IS S9(5)V99...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression b = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression c = { BSTD_EXPRESSION_OPERAND, 2, NULL, NULL };
+    const bstd_expression d = { BSTD_EXPRESSION_OPERAND, 3, NULL, NULL };
+    const bstd_expression e = { BSTD_EXPRESSION_OPERAND, 4, NULL, NULL };
+    const bstd_expression sum = { BSTD_EXPRESSION_ADD, 0, &a, &b };
+    const bstd_expression product = { BSTD_EXPRESSION_MULTIPLY, 0, &sum, &c };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &d, &e };
+    const bstd_expression root = { BSTD_EXPRESSION_SUBTRACT, 0, &product, &quotient };
+    bstd_program *program = bstd_compute_compile(&root);
+
+    // A = 1.5, B = 0.25, C = -3, D = 10, E = 3
+    const bstd_number na = make_number(15, 1, 2, true, true);
+    const bstd_number nb = make_number(25, 2, 3, true, true);
+    const bstd_number nc = make_number(3, 0, 1, true, false);
+    const bstd_number nd = make_number(10, 0, 2, false, true);
+    const bstd_number ne = make_number(3, 0, 1, false, true);
+    const bstd_number *operands[] = { &na, &nb, &nc, &nd, &ne };
+    bstd_number x = make_number(0, 2, 7, true, true);
+
+    // ... when we evaluate it...
+    cr_assert_eq(bstd_compute(program, operands, &x), true);
+
+    // ... then X = 1.75 * -3 - 3.33 = -8.58, truncated only once.
+    cr_assert_eq(x.value, 858);
+    cr_assert_eq(x.positive, false);
+
+    free(program);
+}
+
+Test(compute_tests, compute__no_intermediate_truncation){
+
+    // given COMPUTE X = A * B / C, with A = B = 99999999999999999 and C = 99999999999999999...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression c = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression product = { BSTD_EXPRESSION_MULTIPLY, 0, &a, &a };
+    const bstd_expression root = { BSTD_EXPRESSION_DIVIDE, 0, &product, &c };
+    bstd_program *program = bstd_compute_compile(&root);
+
+    const bstd_number na = make_number(99999999999999999ULL, 0, 17, false, true);
+    const bstd_number *operands[] = { &na, &na };
+    bstd_number x = make_number(0, 0, 18, false, true);
+
+    // ... then the 34-digit product must survive, where bstd_product would keep only 18 digits.
+    cr_assert_eq(bstd_compute(program, operands, &x), true);
+    cr_assert_eq(x.value, 99999999999999999ULL);
+
+    free(program);
+}
+
+Test(compute_tests, compute__negate_and_truncate){
+
+    // given COMPUTE X = -(A / B), with A = 2 and B = 3 and X PICTURE IS S9V9(4)...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression b = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &a, &b };
+    const bstd_expression root = { BSTD_EXPRESSION_NEGATE, 0, &quotient, NULL };
+    bstd_program *program = bstd_compute_compile(&root);
+
+    const bstd_number na = make_number(2, 0, 1, false, true);
+    const bstd_number nb = make_number(3, 0, 1, false, true);
+    const bstd_number *operands[] = { &na, &nb };
+    bstd_number x = make_number(0, 4, 5, true, true);
+
+    // ... then the quotient must be computed at the target's scale and truncated towards zero.
+    cr_assert_eq(bstd_compute(program, operands, &x), true);
+    cr_assert_eq(x.value, 6666);
+    cr_assert_eq(x.positive, false);
+
+    free(program);
+}
+
+Test(compute_tests, compute__size_errors){
+
+    // given COMPUTE X = A / B with B = 0, and COMPUTE X = A * A * A with a 19-digit A...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression b = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &a, &b };
+    const bstd_expression square = { BSTD_EXPRESSION_MULTIPLY, 0, &a, &a };
+    const bstd_expression cube = { BSTD_EXPRESSION_MULTIPLY, 0, &square, &a };
+    bstd_program *division = bstd_compute_compile(&quotient);
+    bstd_program *multiplication = bstd_compute_compile(&cube);
+
+    const bstd_number na = make_number(9999999999999999999ULL, 0, 19, false, true);
+    const bstd_number nb = make_number(0, 0, 1, false, true);
+    const bstd_number *operands[] = { &na, &nb };
+    bstd_number x = make_number(42, 0, 5, false, true);
+
+    // ... then both must fail, leaving X unchanged.
+    cr_assert_eq(bstd_compute(division, operands, &x), false);
+    cr_assert_eq(bstd_compute(multiplication, operands, &x), false);
+    cr_assert_eq(x.value, 42);
+
+    free(division);
+    free(multiplication);
+}
+
+Test(compute_tests, compute__most_negative_intermediate){
+
+    // given COMPUTE X = -(A * B * C) and COMPUTE X = A * B * C / D, where A * B * C = -2^127 and D = -1...
+    const bstd_expression a = { BSTD_EXPRESSION_OPERAND, 0, NULL, NULL };
+    const bstd_expression b = { BSTD_EXPRESSION_OPERAND, 1, NULL, NULL };
+    const bstd_expression c = { BSTD_EXPRESSION_OPERAND, 2, NULL, NULL };
+    const bstd_expression d = { BSTD_EXPRESSION_OPERAND, 3, NULL, NULL };
+    const bstd_expression ab = { BSTD_EXPRESSION_MULTIPLY, 0, &a, &b };
+    const bstd_expression abc = { BSTD_EXPRESSION_MULTIPLY, 0, &ab, &c };
+    const bstd_expression negation = { BSTD_EXPRESSION_NEGATE, 0, &abc, NULL };
+    const bstd_expression quotient = { BSTD_EXPRESSION_DIVIDE, 0, &abc, &d };
+    bstd_program *negate = bstd_compute_compile(&negation);
+    bstd_program *division = bstd_compute_compile(&quotient);
+
+    const bstd_number na = make_number(576460752303423488ULL, 0, 18, true, false);
+    const bstd_number nb = make_number(576460752303423488ULL, 0, 18, true, true);
+    const bstd_number nc = make_number(512, 0, 3, false, true);
+    const bstd_number nd = make_number(1, 0, 1, true, false);
+    const bstd_number *operands[] = { &na, &nb, &nc, &nd };
+    bstd_number x = make_number(42, 0, 5, true, true);
+
+    // ... then both must fail, since 2^127 does not fit 128 bits, leaving X unchanged.
+    cr_assert_eq(bstd_compute(negate, operands, &x), false);
+    cr_assert_eq(bstd_compute(division, operands, &x), false);
+    cr_assert_eq(x.value, 42);
+
+    free(negate);
+    free(division);
+}
@@ -0,0 +1,134 @@
+// the checks must hold in every build type
+#undef NDEBUG
+#include <cassert>
+#include <cstdlib>
+#include "../include/allocator.h"
+#include "../include/arena.h"
+#include "../include/arithmetic.h"
+#include "../include/columnutils.h"
+#include "../include/compact_number.h"
+#include "../include/compactutils.h"
+#include "../include/compute.h"
+#include "../include/encoding.h"
+#include "../include/expression.h"
+#include "../include/number.h"
+#include "../include/number.hpp"
+#include "../include/number_column.h"
+#include "../include/numutils.h"
+#include "../include/picture.h"
+#include "../include/picutils.h"
+#include "../include/wide_number.h"
+#include "../include/wideutils.h"
+
+/*
+ * Tests for number.hpp, compiled as C++ so that every public header is checked to be usable from C++.
+ * Every operator of bstd::number must give the same result as the corresponding C function.
+ */
+
+/**
+ * Scaled values exercised by every test, covering both signs, zero and values that crop.
+ */
+static const int64_t values[] = { 0, 1, -1, 1234, -1234, 5678, -9999, 9999 };
+
+/**
+ * Determines whether the specified numbers hold equal values, regardless of their constraints.
+ */
+static bool equal(const bstd_number &a, const bstd_number &b) {
+    return bstd_number_compare(&a, &b) == 0;
+}
+
+/*
+ * testing that +, - and * match bstd_sum, bstd_difference and bstd_product for differing scales
+ *
+ * in:
+ * lhs: length 4, scale 2, signed
+ * rhs: length 4, scale 1, signed
+ */
+static void giving__matches_c() {
+
+    for (const int64_t l : values) {
+        for (const int64_t r : values) {
+
+            const auto lhs = bstd::number<4, 2, true>::from_scaled(l);
+            const auto rhs = bstd::number<4, 1, true>::from_scaled(r);
+            const bstd_number a = lhs.to_number();
+            const bstd_number b = rhs.to_number();
+
+            bstd_number *sum = bstd_sum(&a, &b);
+            bstd_number *difference = bstd_difference(&a, &b);
+            bstd_number *product = bstd_product(&a, &b);
+
+            assert(equal((lhs + rhs).to_number(), *sum));
+            assert(equal((lhs - rhs).to_number(), *difference));
+            assert(equal((lhs * rhs).to_number(), *product));
+
+            free(sum);
+            free(difference);
+            free(product);
+        }
+    }
+}
+
+/*
+ * testing that +=, -= and *= match bstd_add, bstd_subtract and bstd_multiply, including cropping and dropping the sign
+ *
+ * in:
+ * lhs: length 3, scale 1, unsigned
+ * rhs: length 4, scale 2, signed
+ */
+static void compound__matches_c() {
+
+    for (const int64_t l : values) {
+        for (const int64_t r : values) {
+
+            const auto rhs = bstd::number<4, 2, true>::from_scaled(r);
+            const bstd_number b = rhs.to_number();
+            auto sum = bstd::number<3, 1, false>::from_scaled(l);
+            auto difference = sum;
+            auto product = sum;
+            bstd_number c_sum = sum.to_number();
+            bstd_number c_difference = sum.to_number();
+            bstd_number c_product = sum.to_number();
+
+            sum += rhs;
+            difference -= rhs;
+            product *= rhs;
+            bstd_add(&c_sum, &b);
+            bstd_subtract(&c_difference, &b);
+            bstd_multiply(&c_product, &b);
+
+            assert(equal(sum.to_number(), c_sum));
+            assert(equal(difference.to_number(), c_difference));
+            assert(equal(product.to_number(), c_product));
+        }
+    }
+}
+
+/*
+ * testing that compare matches bstd_number_compare for differing scales
+ *
+ * in:
+ * lhs: length 4, scale 2, signed
+ * rhs: length 4, scale 0, signed
+ */
+static void compare__matches_c() {
+
+    for (const int64_t l : values) {
+        for (const int64_t r : values) {
+
+            const auto lhs = bstd::number<4, 2, true>::from_scaled(l);
+            const auto rhs = bstd::number<4, 0, true>::from_scaled(r);
+            const bstd_number a = lhs.to_number();
+            const bstd_number b = rhs.to_number();
+
+            assert(bstd::compare(lhs, rhs) == bstd_number_compare(&a, &b));
+        }
+    }
+}
+
+int main() {
+    giving__matches_c();
+    compound__matches_c();
+    compare__matches_c();
+    return 0;
+}
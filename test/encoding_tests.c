@@ -0,0 +1,270 @@
+#include <criterion/criterion.h>
+#include <string.h>
+#include "../include/encoding.h"
+
+static bstd_number make_number(uint64_t value, uint64_t scale, uint8_t length, bool isSigned, bool positive) {
+    bstd_number number;
+    number.value = value;
+    number.scale = scale;
+    number.length = length;
+    number.isSigned = isSigned;
+    number.positive = positive;
+    return number;
+}
+
+/*
+ * bstd_number_from_packed
+ */
+
+Test(encoding_tests, number_from_packed__negative){
+
+    // given the PIC S9(3)V99 COMP-3 field for -123.45...
+    const unsigned char bytes[3] = { 0x12, 0x34, 0x5D };
+    bstd_number number = make_number(0, 2, 5, true, true);
+
+    // ... when we decode it...
+    cr_assert_eq(bstd_number_from_packed(&number, bytes, 3), true);
+
+    // ... then the number must hold the value at its implied scale.
+    cr_assert_eq(number.value, 12345);
+    cr_assert_eq(number.positive, false);
+}
+
+Test(encoding_tests, number_from_packed__alternative_signs){
+
+    const unsigned char positive[] = { 0x0A, 0x0C, 0x0E, 0x0F };
+    const unsigned char negative[] = { 0x0B, 0x0D };
+
+    for (size_t i = 0; i < sizeof(positive); ++i) {
+        const unsigned char bytes[2] = { 0x04, (unsigned char) (0x20 | positive[i]) };
+        bstd_number number = make_number(0, 0, 3, true, false);
+        cr_assert_eq(bstd_number_from_packed(&number, bytes, 2), true);
+        cr_assert_eq(number.value, 42);
+        cr_assert_eq(number.positive, true);
+    }
+
+    for (size_t i = 0; i < sizeof(negative); ++i) {
+        const unsigned char bytes[2] = { 0x04, (unsigned char) (0x20 | negative[i]) };
+        bstd_number number = make_number(0, 0, 3, true, true);
+        cr_assert_eq(bstd_number_from_packed(&number, bytes, 2), true);
+        cr_assert_eq(number.value, 42);
+        cr_assert_eq(number.positive, false);
+    }
+}
+
+Test(encoding_tests, number_from_packed__widest){
+
+    // given a 19-digit field, which takes the sixteen-digit fast path...
+    const unsigned char bytes[10] = { 0x98, 0x76, 0x54, 0x32, 0x10, 0x12, 0x34, 0x56, 0x78, 0x9C };
+    bstd_number number = make_number(0, 0, 19, true, false);
+
+    cr_assert_eq(bstd_number_from_packed(&number, bytes, 10), true);
+
+    cr_assert_eq(number.value, 9876543210123456789ULL);
+    cr_assert_eq(number.positive, true);
+}
+
+Test(encoding_tests, number_from_packed__crops_to_length){
+
+    const unsigned char bytes[3] = { 0x12, 0x34, 0x5F };
+    bstd_number number = make_number(0, 0, 3, false, true);
+
+    cr_assert_eq(bstd_number_from_packed(&number, bytes, 3), true);
+
+    cr_assert_eq(number.value, 345);
+}
+
+Test(encoding_tests, number_from_packed__invalid){
+
+    // a digit nibble of 0xA, within and beyond the sixteen-digit fast path, and a digit in the sign position
+    const unsigned char fast[10] = { 0x98, 0x76, 0x54, 0x3A, 0x10, 0x12, 0x34, 0x56, 0x78, 0x9C };
+    const unsigned char slow[10] = { 0x98, 0x76, 0x54, 0x32, 0x10, 0x12, 0x34, 0x56, 0xA8, 0x9C };
+    const unsigned char sign[2] = { 0x12, 0x34 };
+    bstd_number number = make_number(7, 0, 19, true, true);
+
+    cr_assert_eq(bstd_number_from_packed(&number, fast, 10), false);
+    cr_assert_eq(bstd_number_from_packed(&number, slow, 10), false);
+    cr_assert_eq(bstd_number_from_packed(&number, sign, 2), false);
+    cr_assert_eq(bstd_number_from_packed(&number, sign, 0), false);
+    cr_assert_eq(number.value, 7);
+}
+
+/*
+ * bstd_number_to_packed
+ */
+
+Test(encoding_tests, number_to_packed__signs){
+
+    unsigned char bytes[3];
+
+    bstd_number negative = make_number(12345, 2, 5, true, false);
+    bstd_number_to_packed(&negative, bytes, 3);
+    cr_assert_eq(bytes[0], 0x12);
+    cr_assert_eq(bytes[1], 0x34);
+    cr_assert_eq(bytes[2], 0x5D);
+
+    bstd_number positive = make_number(42, 0, 3, true, true);
+    bstd_number_to_packed(&positive, bytes, 2);
+    cr_assert_eq(bytes[0], 0x04);
+    cr_assert_eq(bytes[1], 0x2C);
+
+    bstd_number unsignedNumber = make_number(42, 0, 3, false, false);
+    bstd_number_to_packed(&unsignedNumber, bytes, 2);
+    cr_assert_eq(bytes[1], 0x2F);
+}
+
+Test(encoding_tests, number_to_packed__round_trip){
+
+    const uint64_t values[] = { 0, 1, 99, 100, 123456789, 9876543210123456789ULL, 9999999999999999999ULL };
+
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        bstd_number number = make_number(values[i], 3, 19, true, i % 2 == 0);
+        unsigned char bytes[BSTD_PACKED_SIZE(19)];
+        bstd_number_to_packed(&number, bytes, sizeof(bytes));
+
+        bstd_number result = make_number(0, 3, 19, true, true);
+        cr_assert_eq(bstd_number_from_packed(&result, bytes, sizeof(bytes)), true);
+        cr_assert_eq(result.value, number.value);
+        cr_assert_eq(result.positive, number.positive || number.value == 0);
+    }
+}
+
+/*
+ * bstd_number_from_packed_n / bstd_number_to_packed_n
+ */
+
+Test(encoding_tests, number_packed_n__record_fields){
+
+    // given three 6-byte records, each with a PIC S9(5) COMP-3 field at offset 2...
+    unsigned char records[18];
+    for (size_t i = 0; i < sizeof(records); ++i) {
+        records[i] = 0xEE;
+    }
+
+    const bstd_number numbers[3] = {
+            make_number(12345, 0, 5, true, true),
+            make_number(7, 0, 5, true, false),
+            make_number(0, 0, 5, true, true),
+    };
+
+    // ... when we encode and decode the fields...
+    bstd_number_to_packed_n(numbers, records, 6, 2, BSTD_PACKED_SIZE(5), 3);
+
+    bstd_number decoded[3];
+    for (int i = 0; i < 3; ++i) {
+        decoded[i] = make_number(0, 0, 5, true, true);
+    }
+
+    // ... then every field must round-trip, leaving the rest of the records untouched.
+    cr_assert_eq(bstd_number_from_packed_n(decoded, records, 6, 2, BSTD_PACKED_SIZE(5), 3), 3);
+
+    for (int i = 0; i < 3; ++i) {
+        cr_assert_eq(decoded[i].value, numbers[i].value);
+        cr_assert_eq(decoded[i].positive, numbers[i].positive);
+        cr_assert_eq(records[6 * i], 0xEE);
+        cr_assert_eq(records[6 * i + 1], 0xEE);
+        cr_assert_eq(records[6 * i + 5], 0xEE);
+    }
+    cr_assert_eq(records[10], 0x7D);
+}
+
+/*
+ * bstd_number_from_zoned
+ */
+
+Test(encoding_tests, number_from_zoned__sign_positions){
+
+    // given -123.45 in every signed zoned layout...
+    const char* fields[] = { "1234N", "J2345", "12345-", "-12345" };
+    const bstd_zoned_sign signs[] = { BSTD_ZONED_TRAILING, BSTD_ZONED_LEADING, BSTD_ZONED_TRAILING_SEPARATE, BSTD_ZONED_LEADING_SEPARATE };
+
+    for (size_t i = 0; i < 4; ++i) {
+        bstd_number number = make_number(0, 2, 5, true, true);
+
+        // ... when we decode it...
+        cr_assert_eq(bstd_number_from_zoned(&number, fields[i], strlen(fields[i]), signs[i]), true);
+
+        // ... then the number must hold the value at its implied scale.
+        cr_assert_eq(number.value, 12345);
+        cr_assert_eq(number.positive, false);
+    }
+}
+
+Test(encoding_tests, number_from_zoned__positive_and_plain_digits){
+
+    const char* fields[] = { "0000000000000004{", "00000000000000040", "9876543210123456789" };
+    const uint64_t values[] = { 40, 40, 9876543210123456789ULL };
+    const bstd_zoned_sign signs[] = { BSTD_ZONED_TRAILING, BSTD_ZONED_TRAILING, BSTD_ZONED_UNSIGNED };
+
+    for (size_t i = 0; i < 3; ++i) {
+        bstd_number number = make_number(0, 0, 19, true, false);
+        cr_assert_eq(bstd_number_from_zoned(&number, fields[i], strlen(fields[i]), signs[i]), true);
+        cr_assert_eq(number.value, values[i]);
+        cr_assert_eq(number.positive, true);
+    }
+}
+
+Test(encoding_tests, number_from_zoned__invalid){
+
+    const char* fields[] = { "12a45", "1234S", "12345*", "1234-", "12J45", "" };
+    const bstd_zoned_sign signs[] = { BSTD_ZONED_TRAILING, BSTD_ZONED_TRAILING, BSTD_ZONED_TRAILING_SEPARATE, BSTD_ZONED_UNSIGNED, BSTD_ZONED_LEADING, BSTD_ZONED_TRAILING };
+    bstd_number number = make_number(7, 0, 5, true, true);
+
+    for (size_t i = 0; i < 6; ++i) {
+        cr_assert_eq(bstd_number_from_zoned(&number, fields[i], strlen(fields[i]), signs[i]), false);
+        cr_assert_eq(number.value, 7);
+    }
+}
+
+/*
+ * bstd_number_to_zoned
+ */
+
+Test(encoding_tests, number_to_zoned__sign_positions){
+
+    const bstd_number negative = make_number(12340, 2, 5, true, false);
+    const bstd_number positive = make_number(12340, 2, 5, true, true);
+    char field[7] = { 0 };
+
+    bstd_number_to_zoned(&negative, field, 5, BSTD_ZONED_TRAILING);
+    cr_assert_str_eq(field, "1234}");
+    bstd_number_to_zoned(&positive, field, 5, BSTD_ZONED_TRAILING);
+    cr_assert_str_eq(field, "1234{");
+    bstd_number_to_zoned(&negative, field, 5, BSTD_ZONED_LEADING);
+    cr_assert_str_eq(field, "J2340");
+    bstd_number_to_zoned(&negative, field, 6, BSTD_ZONED_TRAILING_SEPARATE);
+    cr_assert_str_eq(field, "12340-");
+    bstd_number_to_zoned(&positive, field, 6, BSTD_ZONED_LEADING_SEPARATE);
+    cr_assert_str_eq(field, "+12340");
+    bstd_number_to_zoned(&negative, field, 3, BSTD_ZONED_UNSIGNED);
+    cr_assert_eq(memcmp(field, "340", 3), 0);
+}
+
+Test(encoding_tests, number_zoned_n__round_trip){
+
+    // given 20-byte records with an S9(19) trailing-overpunch field at offset 1...
+    const bstd_number numbers[3] = {
+            make_number(9999999999999999999ULL, 0, 19, true, false),
+            make_number(5, 0, 19, true, true),
+            make_number(0, 0, 19, true, false),
+    };
+    char records[60];
+    memset(records, '#', sizeof(records));
+
+    // ... when we encode and decode the fields...
+    bstd_number_to_zoned_n(numbers, records, 20, 1, 19, BSTD_ZONED_TRAILING, 3);
+
+    bstd_number decoded[3];
+    for (int i = 0; i < 3; ++i) {
+        decoded[i] = make_number(1, 0, 19, true, false);
+    }
+
+    // ... then every field must round-trip, leaving the rest of the records untouched.
+    cr_assert_eq(bstd_number_from_zoned_n(decoded, records, 20, 1, 19, BSTD_ZONED_TRAILING, 3), 3);
+
+    for (int i = 0; i < 3; ++i) {
+        cr_assert_eq(decoded[i].value, numbers[i].value);
+        cr_assert_eq(decoded[i].positive, numbers[i].positive || numbers[i].value == 0);
+        cr_assert_eq(records[20 * i], '#');
+    }
+}
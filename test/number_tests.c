@@ -530,3 +530,258 @@ Test(number_tests, number_assign_double__larger_decimal_part){
     const double expected = 12.3;
     cr_assert_float_eq(result, expected, BSTD_NUMBER_TEST_EPSILON, "result: %f | expected: %f", result, expected);
 }
+
+/*
+ * bstd_sum_into
+ */
+
+Test(number_tests, number_sum_into__matches_sum){
+
+    // given two numbers of differing scales...
+    bstd_number n;
+    n.isSigned = true;
+    n.length = 4;
+    n.scale = 2;
+    n.positive = false;
+    n.value = 1234;
+
+    bstd_number m;
+    m.isSigned = false;
+    m.length = 3;
+    m.scale = 1;
+    m.positive = true;
+    m.value = 567;
+
+    // ... when we sum them into a caller-provided number...
+    bstd_number result;
+    bstd_sum_into(&result, &n, &m);
+
+    // ... then the result must equal the allocated sum.
+    bstd_number* expected = bstd_sum(&n, &m);
+
+    cr_assert_eq(result.length, expected->length);
+    cr_assert_eq(result.scale, expected->scale);
+    cr_assert_eq(result.isSigned, expected->isSigned);
+    cr_assert_eq(result.positive, expected->positive);
+    cr_assert_eq(result.value, expected->value);
+
+    free(expected);
+}
+
+Test(number_tests, number_sum_into__aliases_lhs){
+
+    // given a number...
+    bstd_number n;
+    n.isSigned = false;
+    n.length = 3;
+    n.scale = 0;
+    n.positive = true;
+    n.value = 123;
+
+    bstd_number m = n;
+
+    // ... when we sum it into itself...
+    bstd_sum_into(&n, &n, &m);
+
+    // ... then the output must hold the sum of the original operands.
+    cr_assert_eq(n.value, 246);
+    cr_assert_eq(n.scale, 0);
+    cr_assert_eq(n.positive, true);
+}
+
+/*
+ * bstd_difference_into
+ */
+
+Test(number_tests, number_difference_into__negative_result){
+
+    // given a smaller left-hand side...
+    bstd_number n;
+    n.isSigned = false;
+    n.length = 3;
+    n.scale = 1;
+    n.positive = true;
+    n.value = 100;
+
+    bstd_number m;
+    m.isSigned = false;
+    m.length = 3;
+    m.scale = 1;
+    m.positive = true;
+    m.value = 250;
+
+    // ... when we subtract into a caller-provided number...
+    bstd_number result;
+    bstd_difference_into(&result, &n, &m);
+
+    // ... then the result must be a negative, signed number.
+    cr_assert_eq(result.value, 150);
+    cr_assert_eq(result.scale, 1);
+    cr_assert_eq(result.isSigned, true);
+    cr_assert_eq(result.positive, false);
+}
+
+/*
+ * integer-only fixed-point arithmetic
+ */
+
+Test(number_tests, assign_number__eighteen_digits_exact){
+
+    // given a PIC S9(15)V9(3) number holding a value a double cannot represent exactly...
+    bstd_number n;
+    n.isSigned = true;
+    n.length = 18;
+    n.scale = 3;
+    n.positive = false;
+    n.value = 999999999999999999;
+
+    bstd_number m;
+    m.isSigned = true;
+    m.length = 18;
+    m.scale = 3;
+    m.positive = true;
+    m.value = 0;
+
+    // ... when we assign it to a number of the same constraints...
+    bstd_assign_number(&m, &n);
+
+    // ... then every digit must be preserved.
+    cr_assert_eq(m.value, 999999999999999999);
+    cr_assert_eq(m.positive, false);
+}
+
+Test(number_tests, add_int__decimal_exact){
+
+    // given a PIC S9(15)V9(3) number...
+    bstd_number n;
+    n.isSigned = true;
+    n.length = 18;
+    n.scale = 3;
+    n.positive = true;
+    n.value = 123456789012345678;
+
+    // ... when we add an integer to it...
+    bstd_add_int(&n, 1);
+
+    // ... then the integer part must be incremented without disturbing the fraction.
+    cr_assert_eq(n.value, 123456789012346678);
+    cr_assert_eq(n.positive, true);
+}
+
+Test(number_tests, add_double__truncates_exact_sum){
+
+    // given an integer number...
+    bstd_number n;
+    n.isSigned = true;
+    n.length = 3;
+    n.scale = 0;
+    n.positive = true;
+    n.value = 1;
+
+    // ... when we add a negative fraction to it...
+    bstd_add_double(&n, -0.5);
+
+    // ... then the exact sum (0.5) must be truncated towards zero.
+    cr_assert_eq(n.value, 0);
+    cr_assert_eq(n.positive, true);
+}
+
+Test(number_tests, number_sum__power_of_ten_length){
+
+    // given two numbers summing to an exact power of ten...
+    bstd_number n;
+    n.isSigned = false;
+    n.length = 3;
+    n.scale = 0;
+    n.positive = true;
+    n.value = 999;
+
+    bstd_number m;
+    m.isSigned = false;
+    m.length = 1;
+    m.scale = 0;
+    m.positive = true;
+    m.value = 1;
+
+    // ... when we sum them...
+    bstd_number result;
+    bstd_sum_into(&result, &n, &m);
+
+    // ... then the length of the result must count every digit.
+    cr_assert_eq(result.value, 1000);
+    cr_assert_eq(result.length, 4);
+}
+
+Test(number_tests, number_compare__fractions){
+
+    // given 1.2 and 1.9...
+    bstd_number n;
+    n.isSigned = false;
+    n.length = 2;
+    n.scale = 1;
+    n.positive = true;
+    n.value = 12;
+
+    bstd_number m = n;
+    m.value = 19;
+
+    // ... then their fractions must decide the comparison.
+    cr_assert_eq(bstd_number_compare(&n, &m), -1);
+    cr_assert_eq(bstd_number_compare(&m, &n), 1);
+    cr_assert_eq(bstd_less_than(&n, &m), true);
+    cr_assert_eq(bstd_greater_than(&n, &m), false);
+    cr_assert_eq(bstd_number_equals(&n, &m), false);
+}
+
+Test(number_tests, number_compare__different_scales){
+
+    // given -1.5 and -1.50...
+    bstd_number n;
+    n.isSigned = true;
+    n.length = 2;
+    n.scale = 1;
+    n.positive = false;
+    n.value = 15;
+
+    bstd_number m;
+    m.isSigned = true;
+    m.length = 18;
+    m.scale = 17;
+    m.positive = false;
+    m.value = 150000000000000000;
+
+    // ... then they must compare equal...
+    cr_assert_eq(bstd_number_compare(&n, &m), 0);
+    cr_assert_eq(bstd_number_equals(&n, &m), true);
+
+    // ... and -1.50000000000000001 must be less than both.
+    m.value++;
+    cr_assert_eq(bstd_number_compare(&m, &n), -1);
+    cr_assert_eq(bstd_less_than(&m, &n), true);
+}
+
+Test(number_tests, number_compare__signs){
+
+    // given a negative zero, an unsigned number with a negative flag and a negative number...
+    bstd_number zero;
+    zero.isSigned = true;
+    zero.length = 1;
+    zero.scale = 0;
+    zero.positive = false;
+    zero.value = 0;
+
+    bstd_number unsignedNumber;
+    unsignedNumber.isSigned = false;
+    unsignedNumber.length = 1;
+    unsignedNumber.scale = 0;
+    unsignedNumber.positive = false;
+    unsignedNumber.value = 3;
+
+    bstd_number negative = unsignedNumber;
+    negative.isSigned = true;
+
+    // ... then zero must not be negative, and the flag of unsigned numbers must be ignored.
+    cr_assert_eq(bstd_number_compare(&zero, &negative), 1);
+    cr_assert_eq(bstd_number_compare(&zero, &unsignedNumber), -1);
+    cr_assert_eq(bstd_number_compare(&negative, &unsignedNumber), -1);
+}
@@ -1,4 +1,6 @@
 #include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <string.h>
 #include "../include/numutils.h"
 
 #ifndef BSTD_NUMBER_TEST_EPSILON
@@ -4283,4 +4285,351 @@ Test(numutils_tests, bstd_assign_double__value_eq_negative_999999999){
     cr_assert_eq(ex.isSigned,   number.isSigned);
     cr_assert_eq(ex.positive,   number.positive);
 
-}
\ No newline at end of file
+}
+/**
+ * Tests for void bstd_number_sort_key(const bstd_number* number, unsigned char* key)
+ *
+ * Keys are compared with memcmp; their order must equal the numeric order of the numbers.
+ */
+
+static bstd_number sort_key_number(uint64_t value, uint64_t scale, bool isSigned, bool positive) {
+    bstd_number number;
+    number.value = value;
+    number.scale = scale;
+    number.length = 19;
+    number.isSigned = isSigned;
+    number.positive = positive;
+    return number;
+}
+
+Test(numutils_tests, bstd_number_sort_key__equal_values_equal_keys){
+
+    bstd_number n = sort_key_number(15, 1, true, false);
+    bstd_number m = sort_key_number(1500, 3, true, false);
+
+    unsigned char n_key[BSTD_NUMBER_SORT_KEY_SIZE];
+    unsigned char m_key[BSTD_NUMBER_SORT_KEY_SIZE];
+    bstd_number_sort_key(&n, n_key);
+    bstd_number_sort_key(&m, m_key);
+
+    cr_assert_arr_eq(n_key, m_key, BSTD_NUMBER_SORT_KEY_SIZE);
+}
+
+Test(numutils_tests, bstd_number_sort_key__negative_zero){
+
+    bstd_number n = sort_key_number(0, 2, true, false);
+    bstd_number m = sort_key_number(0, 0, false, true);
+
+    unsigned char n_key[BSTD_NUMBER_SORT_KEY_SIZE];
+    unsigned char m_key[BSTD_NUMBER_SORT_KEY_SIZE];
+    bstd_number_sort_key(&n, n_key);
+    bstd_number_sort_key(&m, m_key);
+
+    cr_assert_arr_eq(n_key, m_key, BSTD_NUMBER_SORT_KEY_SIZE);
+}
+
+Test(numutils_tests, bstd_number_sort_key__order_matches_compare){
+
+    const bstd_number numbers[] = {
+            sort_key_number(10000000000000000000ULL, 0, true, false),
+            sort_key_number(19, 1, true, false),
+            sort_key_number(12, 1, true, false),
+            sort_key_number(1, 19, true, false),
+            sort_key_number(0, 0, true, true),
+            sort_key_number(1, 19, false, true),
+            sort_key_number(12, 1, false, false),
+            sort_key_number(199, 2, true, true),
+            sort_key_number(10000000000000000000ULL, 0, false, true),
+    };
+    const size_t n = sizeof(numbers) / sizeof(numbers[0]);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            unsigned char i_key[BSTD_NUMBER_SORT_KEY_SIZE];
+            unsigned char j_key[BSTD_NUMBER_SORT_KEY_SIZE];
+            bstd_number_sort_key(&numbers[i], i_key);
+            bstd_number_sort_key(&numbers[j], j_key);
+
+            const int order = memcmp(i_key, j_key, BSTD_NUMBER_SORT_KEY_SIZE);
+
+            cr_assert_eq((order > 0) - (order < 0), bstd_number_compare(&numbers[i], &numbers[j]));
+            cr_assert_eq((order > 0) - (order < 0), (i > j) - (i < j));
+        }
+    }
+}
+
+/**
+ * Tests for size_t bstd_number_format_into(char* buf, size_t cap, const bstd_number* number)
+ * Equivalence classes:
+ * +--------------------------+--------------------------------------+
+ * | Condition                | Valid                                |
+ * +--------------------------+--------------------------------------+
+ * | Value of number.scale    | number.scale = 0,                    |
+ * |                          | 0 < number.scale < number.length,    |
+ * |                          | number.scale = number.length         |
+ * | Value of number.isSigned | number.isSigned = false,             |
+ * |                          | number.isSigned = true               |
+ * | Value of cap             | cap > size, cap = size               |
+ * | Digits                   | at most 19 (more is an error)        |
+ * +--------------------------+--------------------------------------+
+ */
+
+Test(numutils_tests, bstd_number_format_into__unsigned_integer){
+    bstd_number number;
+    number.value = 42;
+    number.scale = 0;
+    number.length = 4;
+    number.isSigned = false;
+    number.positive = true;
+
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    const size_t size = bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_eq(size, 4);
+    cr_assert_str_eq(buf, "0042");
+}
+
+Test(numutils_tests, bstd_number_format_into__signed_negative_decimal){
+    bstd_number number;
+    number.value = 150;
+    number.scale = 2;
+    number.length = 5;
+    number.isSigned = true;
+    number.positive = false;
+
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    const size_t size = bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_eq(size, 7);
+    cr_assert_str_eq(buf, "-001.50");
+}
+
+Test(numutils_tests, bstd_number_format_into__signed_positive_fraction_only){
+    bstd_number number;
+    number.value = 5555;
+    number.scale = 9;
+    number.length = 9;
+    number.isSigned = true;
+    number.positive = true;
+
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_str_eq(buf, "+.000005555");
+}
+
+Test(numutils_tests, bstd_number_format_into__crops_to_length){
+    bstd_number number;
+    number.value = 999999999;
+    number.scale = 3;
+    number.length = 4;
+    number.isSigned = false;
+    number.positive = true;
+
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_str_eq(buf, "9.999");
+}
+
+Test(numutils_tests, bstd_number_format_into__max_length){
+    bstd_number number;
+    number.value = 9999999999999999999ULL;
+    number.scale = 1;
+    number.length = 19;
+    number.isSigned = true;
+    number.positive = false;
+
+    char buf[BSTD_NUMBER_FORMAT_MAX_SIZE];
+    const size_t size = bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_eq(size, 21);
+    cr_assert_str_eq(buf, "-999999999999999999.9");
+}
+
+Test(numutils_tests, bstd_number_format_into__buffer_too_small){
+    bstd_number number;
+    number.value = 12;
+    number.scale = 1;
+    number.length = 2;
+    number.isSigned = false;
+    number.positive = true;
+
+    char buf[3] = "ab";
+    const size_t size = bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_eq(size, 3);
+    cr_assert_str_eq(buf, "ab");
+
+    char fits[4];
+    bstd_number_format_into(fits, sizeof(fits), &number);
+    cr_assert_str_eq(fits, "1.2");
+}
+
+Test(numutils_tests, bstd_number_format_into__too_many_digits){
+    bstd_number number;
+    number.value = 12;
+    number.scale = 20;
+    number.length = 20;
+    number.isSigned = false;
+    number.positive = true;
+
+    char buf[64] = "ab";
+    const size_t size = bstd_number_format_into(buf, sizeof(buf), &number);
+
+    cr_assert_eq(size, BSTD_NUMBER_FORMAT_ERROR);
+    cr_assert_str_eq(buf, "ab");
+}
+
+/**
+ * Tests for void bstd_print_number(bstd_number number, bool advancing)
+ */
+
+Test(numutils_tests, bstd_print_number__display, .init = cr_redirect_stdout){
+    bstd_number number;
+    number.value = 150;
+    number.scale = 2;
+    number.length = 5;
+    number.isSigned = true;
+    number.positive = false;
+
+    bstd_number counter;
+    counter.value = 42;
+    counter.scale = 0;
+    counter.length = 4;
+    counter.isSigned = false;
+    counter.positive = true;
+
+    bstd_print_number(number, false);
+    bstd_print_number(counter, true);
+    fflush(stdout);
+
+    cr_assert_stdout_eq_str("-001.50 0042");
+}
+
+/**
+ * Tests for bool bstd_number_parse(bstd_number* number, const char* str, size_t len)
+ * Equivalence classes:
+ * +----------------------+---------------------------------------+-------------------------------------+
+ * | Condition            | Valid                                 | Invalid                             |
+ * +----------------------+---------------------------------------+-------------------------------------+
+ * | Sign                 | none, '+', '-'                        | sign without digits                 |
+ * | Decimal point        | none, one                             | more than one                       |
+ * | Digits               | 1 to 19 significant integer digits    | none, non-digits, over 19 digits    |
+ * | Fractional digits    | <= number.scale, > number.scale       |                                     |
+ * | Surrounding spaces   | none, leading, trailing               | embedded                            |
+ * +----------------------+---------------------------------------+-------------------------------------+
+ */
+
+static bstd_number parse_target(uint64_t scale, uint8_t length, bool isSigned) {
+    bstd_number number;
+    number.value = 7;
+    number.scale = scale;
+    number.length = length;
+    number.isSigned = isSigned;
+    number.positive = true;
+    return number;
+}
+
+Test(numutils_tests, bstd_number_parse__signed_decimal){
+    bstd_number number = parse_target(2, 7, true);
+
+    cr_assert_eq(bstd_number_parse(&number, "-1234.5", 7), true);
+
+    cr_assert_eq(number.value, 123450);
+    cr_assert_eq(number.positive, false);
+}
+
+Test(numutils_tests, bstd_number_parse__truncates_and_crops){
+    bstd_number number = parse_target(1, 3, false);
+
+    // 12345.678 truncated to one fractional digit and cropped to three digits, without sign
+    cr_assert_eq(bstd_number_parse(&number, "  -12345.678 ", 13), true);
+
+    cr_assert_eq(number.value, 456);
+    cr_assert_eq(number.positive, true);
+}
+
+Test(numutils_tests, bstd_number_parse__long_runs){
+    bstd_number number = parse_target(0, 19, true);
+
+    cr_assert_eq(bstd_number_parse(&number, "+0009999999999999999999", 23), true);
+    cr_assert_eq(number.value, 9999999999999999999ULL);
+
+    number = parse_target(18, 19, false);
+    cr_assert_eq(bstd_number_parse(&number, ".123456789012345678999", 22), true);
+    cr_assert_eq(number.value, 123456789012345678ULL);
+}
+
+Test(numutils_tests, bstd_number_parse__invalid){
+    const char* invalid[] = { "", "   ", "-", ".", "+-1", "1.2.3", "12a45678", "123456789x", "1 2", "1.23456789a", "12345678901234567890" };
+
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        bstd_number number = parse_target(2, 9, true);
+
+        cr_assert_eq(bstd_number_parse(&number, invalid[i], strlen(invalid[i])), false);
+        cr_assert_eq(number.value, 7);
+    }
+}
+
+Test(numutils_tests, bstd_number_parse_n__fixed_width){
+    bstd_number numbers[4];
+    for (int i = 0; i < 4; ++i) {
+        numbers[i] = parse_target(2, 5, true);
+    }
+
+    const char* data = "  1.50-12.34  bad 999.99";
+
+    cr_assert_eq(bstd_number_parse_n(numbers, data, 6, 4), 3);
+
+    cr_assert_eq(numbers[0].value, 150);
+    cr_assert_eq(numbers[1].value, 1234);
+    cr_assert_eq(numbers[1].positive, false);
+    cr_assert_eq(numbers[2].value, 7);
+    cr_assert_eq(numbers[3].value, 99999);
+}
+
+/**
+ * Tests for bool bstd_assign_number_checked(bstd_number* assignee, const bstd_number* value)
+ * and bool bstd_assign_int64_checked(bstd_number* number, int64_t value)
+ *
+ * A size error occurs iff the integer digits of the value do not fit the assignee; truncated fractions are no size error.
+ */
+
+Test(numutils_tests, bstd_assign_number_checked__truncation_is_no_size_error){
+    bstd_number assignee = parse_target(1, 3, true);
+    bstd_number value = parse_target(3, 5, true);
+    value.value = 12345;
+    value.positive = false;
+
+    cr_assert_eq(bstd_assign_number_checked(&assignee, &value), true);
+
+    cr_assert_eq(assignee.value, 123);
+    cr_assert_eq(assignee.positive, false);
+}
+
+Test(numutils_tests, bstd_assign_number_checked__size_error){
+    bstd_number assignee = parse_target(1, 3, true);
+    bstd_number value = parse_target(1, 5, true);
+    value.value = 1000;
+
+    cr_assert_eq(bstd_assign_number_checked(&assignee, &value), false);
+
+    cr_assert_eq(assignee.value, 7);
+}
+
+Test(numutils_tests, bstd_assign_int64_checked__limits){
+    bstd_number number = parse_target(2, 4, false);
+
+    cr_assert_eq(bstd_assign_int64_checked(&number, -99), true);
+    cr_assert_eq(number.value, 9900);
+    cr_assert_eq(number.positive, true);
+
+    cr_assert_eq(bstd_assign_int64_checked(&number, 100), false);
+    cr_assert_eq(number.value, 9900);
+
+    number = parse_target(0, 19, true);
+    cr_assert_eq(bstd_assign_int64_checked(&number, INT64_MIN), true);
+    cr_assert_eq(number.value, (uint64_t) INT64_MAX + 1);
+    cr_assert_eq(number.positive, false);
+}
@@ -1,4 +1,6 @@
 #include <criterion/criterion.h>
+#include <criterion/redirect.h>
+#include <string.h>
 #include "../include/picutils.h"
 
 /**
@@ -197,6 +199,33 @@ Test(picutils_tests, bstd_mask__mask_9_byte_9){
     cr_assert_eq(res, '9');
 }
 
+/*
+ * testing invalid condition byte > 9 with mask = '9'
+ * only the least-significant digit of the byte is kept
+ *
+ * in: mask = ‘9’ , byte = 10, 100, 255
+ * expected = '0', '0', '5'
+ *
+ */
+Test(picutils_tests, bstd_mask__mask_9_byte_gt_9){
+    cr_assert_eq(bstd_mask(10, BSTD_MASK_9), '0');
+    cr_assert_eq(bstd_mask(100, BSTD_MASK_9), '0');
+    cr_assert_eq(bstd_mask(255, BSTD_MASK_9), '5');
+}
+
+/*
+ * testing invalid condition byte > 127 with mask = 'A'
+ *
+ * in: mask = ‘A’ , byte = 200
+ * expected = ' '
+ *
+ */
+Test(picutils_tests, bstd_mask__mask_A_byte_gt_127){
+    char res = bstd_mask(200, BSTD_MASK_A);
+
+    cr_assert_eq(res, BSTD_SPACE);
+}
+
 /*
  * testing boundary value byte = 0 with mask = 'X'
  *
@@ -4206,4 +4235,221 @@ Test(picutils_tests, std_assign_picture__value_max_length) {
     for (int i = 0; i < assignee->length; ++i) {
         cr_assert_eq(assignee->bytes[i], ex.bytes[i]);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Tests for void bstd_picture_sort_key(const bstd_picture *picture, unsigned char *key, size_t width)
+ *
+ * Equivalence classes:
+ * +---------------+------------------------+
+ * |   Condition   |         Valid          |
+ * +---------------+------------------------+
+ * | width         | < length (1)           |
+ * |               | = length (2)           |
+ * |               | > length (3)           |
+ * +---------------+------------------------+
+ */
+
+Test(picutils_tests, picture_sort_key__masked_padded) {
+
+    unsigned char bytes[3] = {'a', 1, 13};
+    char mask[3] = {BSTD_MASK_A, BSTD_MASK_9, BSTD_MASK_9};
+    bstd_picture *picture = bstd_picture_of(bytes, mask, 3);
+
+    unsigned char key[5];
+    bstd_picture_sort_key(picture, key, 5);
+
+    cr_assert_arr_eq(key, "a13  ", 5);
+
+    bstd_picture_sort_key(picture, key, 3);
+    cr_assert_arr_eq(key, "a13", 3);
+
+    bstd_picture_sort_key(picture, key, 2);
+    cr_assert_arr_eq(key, "a1", 2);
+}
+
+Test(picutils_tests, picture_sort_key__shorter_picture_sorts_first) {
+
+    unsigned char short_bytes[2] = {'A', 'B'};
+    unsigned char long_bytes[3] = {'A', 'B', '!'};
+    char mask[3] = {BSTD_MASK_X, BSTD_MASK_X, BSTD_MASK_X};
+    bstd_picture *shorter = bstd_picture_of(short_bytes, mask, 2);
+    bstd_picture *longer = bstd_picture_of(long_bytes, mask, 3);
+
+    unsigned char short_key[4];
+    unsigned char long_key[4];
+    bstd_picture_sort_key(shorter, short_key, 4);
+    bstd_picture_sort_key(longer, long_key, 4);
+
+    // "AB " < "AB!" since a space precedes '!'
+    cr_assert_lt(memcmp(short_key, long_key, 4), 0);
+}
+
+/*
+ * Tests for the compiled picture layout
+ *
+ * Equivalence classes:
+ * +---------------+--------------------------------+
+ * |   Condition   |             Valid              |
+ * +---------------+--------------------------------+
+ * | layout        | compiled at creation (1)       |
+ * |               | absent, compiled on the fly (2)|
+ * | runs          | aligned in both pictures (3)   |
+ * |               | crossing each other (4)        |
+ * +---------------+--------------------------------+
+ */
+
+Test(picutils_tests, picture_layout__runs) {
+
+    bstd_picture *picture = bstd_create_picture("XXX999AAX");
+
+    cr_assert_not_null(picture->layout);
+    cr_assert_eq(picture->layout->count, 4);
+    cr_assert_eq(picture->layout->runs[1].start, 3);
+    cr_assert_eq(picture->layout->runs[1].length, 3);
+    cr_assert_eq(picture->layout->runs[1].mask, BSTD_MASK_9);
+    cr_assert_eq(picture->layout->runs[3].start, 8);
+    cr_assert_eq(picture->layout->runs[3].length, 1);
+}
+
+Test(picutils_tests, picture_layout__crossing_runs_match_masks) {
+
+    unsigned char bytes[8] = {'a', '1', '%', 7, 8, 'z', 'Q', 3};
+    char from_mask[8] = {BSTD_MASK_X, BSTD_MASK_X, BSTD_MASK_X, BSTD_MASK_9, BSTD_MASK_9, BSTD_MASK_A, BSTD_MASK_A, BSTD_MASK_9};
+    bstd_picture *value = bstd_picture_of(bytes, from_mask, 8);
+    bstd_picture *assignee = bstd_create_picture("A99XXXX9");
+
+    bstd_assign_picture(assignee, value);
+
+    for (int i = 0; i < 8; ++i) {
+        cr_assert_eq(assignee->bytes[i], bstd_unmask(bstd_mask(bytes[i], from_mask[i]), assignee->mask[i]));
+    }
+}
+
+Test(picutils_tests, picture_layout__absent) {
+
+    unsigned char bytes[4] = {'a', 4, '!', ' '};
+    char mask[4] = {BSTD_MASK_A, BSTD_MASK_9, BSTD_MASK_X, BSTD_MASK_X};
+    bstd_picture picture = BSTD_PICTURE_INIT(bytes, mask, 4);
+
+    char *str = bstd_picture_to_cstr(&picture);
+    cr_assert_str_eq(str, "a4! ");
+
+    bstd_assign_str(&picture, "b7");
+    cr_assert_eq(bytes[0], 'b');
+    cr_assert_eq(bytes[1], 7);
+    cr_assert_eq(bytes[2], BSTD_SPACE);
+}
+
+Test(picutils_tests, picture_layout__long_runs_match_masks) {
+
+    unsigned char bytes[240];
+    char str[241];
+    for (int i = 0; i < 240; ++i) {
+        bytes[i] = (unsigned char) (i * 7);
+        str[i] = (char) (i + 1);
+    }
+    str[240] = '\0';
+
+    char mask[240];
+    memset(mask, BSTD_MASK_9, 100);
+    memset(mask + 100, BSTD_MASK_A, 140);
+    bstd_picture *picture = bstd_picture_of(bytes, mask, 240);
+
+    char *masked = bstd_picture_to_cstr(picture);
+    for (int i = 0; i < 240; ++i) {
+        cr_assert_eq(masked[i], bstd_mask(bytes[i], mask[i]));
+    }
+
+    bstd_assign_str(picture, str);
+    for (int i = 0; i < 240; ++i) {
+        cr_assert_eq(picture->bytes[i], bstd_unmask(str[i], mask[i]));
+    }
+}
+
+/*
+ * Tests for mask interning
+ */
+
+Test(picutils_tests, picture_interning__equal_masks_shared) {
+
+    char mask[4] = {BSTD_MASK_X, BSTD_MASK_X, BSTD_MASK_9, BSTD_MASK_9};
+    unsigned char bytes[4] = {'a', 'b', 1, 2};
+
+    bstd_picture *created = bstd_create_picture("XX99");
+    bstd_picture *copied = bstd_picture_of(bytes, mask, 4);
+    bstd_picture *other = bstd_create_picture("XX999");
+
+    cr_assert_eq(created->mask, copied->mask);
+    cr_assert_eq(created->layout, copied->layout);
+    cr_assert_neq(created->mask, other->mask);
+    cr_assert_neq(created->bytes, copied->bytes);
+}
+
+Test(picutils_tests, picture_interning__cached_plan_matches_masks) {
+
+    unsigned char bytes[6] = {'a', '%', 7, 'Q', 3, '!'};
+    char mask[6] = {BSTD_MASK_X, BSTD_MASK_X, BSTD_MASK_9, BSTD_MASK_A, BSTD_MASK_9, BSTD_MASK_X};
+    bstd_picture *value = bstd_picture_of(bytes, mask, 6);
+
+    // the second move replays the plan cached by the first
+    for (int round = 0; round < 2; ++round) {
+        bstd_picture *assignee = bstd_create_picture("A9XXA");
+        bstd_assign_picture(assignee, value);
+
+        for (int i = 0; i < 5; ++i) {
+            cr_assert_eq(assignee->bytes[i], bstd_unmask(bstd_mask(bytes[i], mask[i]), assignee->mask[i]));
+        }
+    }
+}
+
+/*
+ * Tests for single-allocation and inline pictures
+ */
+
+Test(picutils_tests, picture_single_allocation__bytes_inline) {
+
+    bstd_picture *picture = bstd_create_picture("XXA99");
+
+    cr_assert_eq(picture->bytes, picture->data);
+    cr_assert_eq(picture->length, 5);
+    cr_assert_eq(picture->bytes[4], 0);
+}
+
+Test(picutils_tests, picture_init_in__storage) {
+
+    bstd_picture_storage storage;
+    bstd_picture *picture = bstd_picture_init_in(&storage, "XX99");
+
+    cr_assert_not_null(picture);
+    cr_assert_eq((void *) picture, (void *) &storage);
+    cr_assert_eq(picture->bytes[0], BSTD_SPACE);
+    cr_assert_eq(picture->bytes[3], 0);
+
+    bstd_assign_str(picture, "ab12");
+    cr_assert_str_eq(bstd_picture_to_cstr(picture), "ab12");
+}
+
+Test(picutils_tests, picture_init_in__too_long) {
+
+    bstd_picture_storage storage;
+
+    cr_assert_null(bstd_picture_init_in(&storage, "XXXXXXXXXXXXXXXXXXXXXXXXX"));
+    cr_assert_not_null(bstd_picture_init_in(&storage, "XXXXXXXXXXXXXXXXXXXXXXXX"));
+}
+
+/**
+ * Tests for void bstd_print_picture(const bstd_picture *picture, bool advancing)
+ */
+
+Test(picutils_tests, bstd_print_picture__advancing, .init = cr_redirect_stdout) {
+
+    bstd_picture *picture = bstd_create_picture("XA9");
+    bstd_assign_str(picture, "a-7");
+
+    bstd_print_picture(picture, false);
+    bstd_print_picture(picture, true);
+    fflush(stdout);
+
+    cr_assert_stdout_eq_str("a 7 a 7");
+}
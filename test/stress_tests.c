@@ -161,3 +161,103 @@ Test(stress_tests, number_addition_fuzz){
         cr_assert_float_eq(fo, ex, BSTD_STRESS_TEST_EPSILON);
     }
 }
+
+/**
+ * fuzzing division by prepared divisors against plain division
+ */
+Test(stress_tests, number_divide_by_fuzz){
+    srand(0x007734); /// seed rng for reproducibility
+    for(int i = 0; i < 10000; i++){
+        bstd_number d;
+        d.value = ((uint64_t) rand() << 31 | (uint64_t) rand()) >> aux_random_int(0, 61);
+        d.scale = aux_random_uint64_t(0, 4);
+        d.length = 18;
+        d.isSigned = aux_random_int(0, 1);
+        d.positive = d.isSigned ? aux_random_int(0, 1) : true;
+        if (d.value == 0) {
+            d.value = 1;
+        }
+
+        bstd_divisor prepared;
+        bstd_divisor_init(&prepared, &d);
+
+        bstd_number n;
+        n.value = (uint64_t) rand() << 31 | (uint64_t) rand();
+        n.scale = aux_random_uint64_t(0, 4);
+        n.length = 18;
+        n.isSigned = true;
+        n.positive = aux_random_int(0, 1);
+
+        bstd_number expected = n;
+        bstd_number result = n;
+        bstd_divide(&expected, &d);
+        bstd_divide_by(&result, &prepared);
+
+        cr_assert_eq(result.value, expected.value);
+        cr_assert_eq(result.positive, expected.positive);
+    }
+}
+
+/**
+ * fuzzing batch addition and subtraction against element-wise bstd_add and bstd_subtract
+ */
+Test(stress_tests, number_add_n_fuzz){
+    srand(0x007734); /// seed rng for reproducibility
+    enum { COUNT = 1000 };
+    for(int round = 0; round < 100; round++){
+        const uint8_t length = aux_random_uint8_t(1, 18);
+        const uint64_t scale = aux_random_uint64_t(0, length);
+        const bool lhs_signed = aux_random_int(0, 1);
+        const bool rhs_signed = aux_random_int(0, 1);
+        const uint8_t rhs_length = aux_random_uint8_t(1, length);
+        const bool subtract = aux_random_int(0, 1);
+
+        bstd_number lhs[COUNT];
+        bstd_number rhs[COUNT];
+        bstd_number expected[COUNT];
+
+        for (int i = 0; i < COUNT; i++) {
+            lhs[i].value = ((uint64_t) rand() << 31 | (uint64_t) rand()) % (uint64_t) pow(10, length);
+            lhs[i].scale = scale;
+            lhs[i].length = length;
+            lhs[i].isSigned = lhs_signed;
+            lhs[i].positive = lhs_signed ? aux_random_int(0, 1) : true;
+
+            rhs[i].value = ((uint64_t) rand() << 31 | (uint64_t) rand()) % (uint64_t) pow(10, rhs_length);
+            rhs[i].scale = scale;
+            rhs[i].length = rhs_length;
+            rhs[i].isSigned = rhs_signed;
+            rhs[i].positive = rhs_signed ? aux_random_int(0, 1) : true;
+
+            expected[i] = lhs[i];
+            if (subtract) {
+                bstd_subtract(&expected[i], &rhs[i]);
+            } else {
+                bstd_add(&expected[i], &rhs[i]);
+            }
+        }
+
+        if (subtract) {
+            bstd_subtract_n(lhs, rhs, COUNT);
+        } else {
+            bstd_add_n(lhs, rhs, COUNT);
+        }
+
+        for (int i = 0; i < COUNT; i++) {
+            cr_assert_eq(lhs[i].value, expected[i].value);
+            cr_assert_eq(lhs[i].positive, expected[i].positive);
+        }
+
+        for (int i = 0; i < COUNT; i++) {
+            expected[i] = lhs[i];
+            bstd_add(&expected[i], &rhs[0]);
+        }
+
+        bstd_add_scalar_n(lhs, &rhs[0], COUNT);
+
+        for (int i = 0; i < COUNT; i++) {
+            cr_assert_eq(lhs[i].value, expected[i].value);
+            cr_assert_eq(lhs[i].positive, expected[i].positive);
+        }
+    }
+}
@@ -0,0 +1,275 @@
+#include <criterion/criterion.h>
+#include "../include/wideutils.h"
+
+/*
+ * bstd_wide_assign_number
+ */
+
+Test(wideutils_tests, wide_assign_number__aligns_scale){
+
+    // given a PIC S9(31)V99 total and a PIC S9(5)V9(3) amount...
+    bstd_wide_number total;
+    total.isSigned = true;
+    total.length = 33;
+    total.scale = 2;
+    total.positive = true;
+    total.value = 0;
+
+    bstd_number amount;
+    amount.isSigned = true;
+    amount.length = 8;
+    amount.scale = 3;
+    amount.positive = false;
+    amount.value = 12345678;
+
+    // ... when we assign the amount to the total...
+    bstd_wide_assign_number(&total, &amount);
+
+    // ... then the amount must be truncated to the total's scale.
+    cr_assert(total.value == 1234567);
+    cr_assert_eq(total.positive, false);
+}
+
+/*
+ * bstd_wide_assign
+ */
+
+Test(wideutils_tests, wide_assign__raises_scale_at_digit_limit){
+
+    // given a PIC 9(36)V99 assignee...
+    bstd_wide_number assignee;
+    assignee.isSigned = false;
+    assignee.length = 38;
+    assignee.scale = 2;
+    assignee.positive = true;
+    assignee.value = 0;
+
+    // ... and a PIC 9(38) value holding the largest 38-digit value...
+    bstd_wide_number value;
+    value.isSigned = false;
+    value.length = 38;
+    value.scale = 0;
+    value.positive = true;
+    value.value = (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999999ULL;
+
+    // ... when we assign the value to the assignee...
+    bstd_wide_assign(&assignee, &value);
+
+    // ... then the assignee must hold the 36 low-order integer digits and no fraction.
+    cr_assert(assignee.value == (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999900ULL);
+}
+
+/*
+ * bstd_wide_add_number
+ */
+
+Test(wideutils_tests, wide_add_number__beyond_eighteen_digits){
+
+    // given a total just below 10^30...
+    bstd_wide_number total;
+    total.isSigned = true;
+    total.length = 33;
+    total.scale = 2;
+    total.positive = true;
+    total.value = (unsigned __int128) 999999999999999999 * 1000000000000 + 999999999999;
+
+    bstd_number one_cent;
+    one_cent.isSigned = false;
+    one_cent.length = 3;
+    one_cent.scale = 2;
+    one_cent.positive = true;
+    one_cent.value = 1;
+
+    // ... when we add a single cent...
+    bstd_wide_add_number(&total, &one_cent);
+
+    // ... then the total must carry into its 31st digit without loss.
+    cr_assert(total.value == (unsigned __int128) 1000000000000000000 * 1000000000000);
+}
+
+/*
+ * bstd_wide_add
+ */
+
+Test(wideutils_tests, wide_add__crops_to_length){
+
+    // given a wide number of length 20...
+    bstd_wide_number n;
+    n.isSigned = false;
+    n.length = 20;
+    n.scale = 0;
+    n.positive = true;
+    n.value = (unsigned __int128) 99999999999999999 * 1000 + 999;
+
+    bstd_wide_number m = n;
+    m.value = 1;
+
+    // ... when the sum exceeds twenty digits...
+    bstd_wide_add(&n, &m);
+
+    // ... then the high-order digit must be cropped.
+    cr_assert(n.value == 0);
+}
+
+Test(wideutils_tests, wide_add__at_digit_limit){
+
+    // given two PIC 9(38) numbers holding the largest 38-digit value...
+    bstd_wide_number n;
+    n.isSigned = false;
+    n.length = 38;
+    n.scale = 0;
+    n.positive = true;
+    n.value = (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999999ULL;
+
+    bstd_wide_number m = n;
+
+    // ... when we add them...
+    bstd_wide_add(&n, &m);
+
+    // ... then the sum must be cropped to its 38 low-order digits.
+    cr_assert(n.value == (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999998ULL);
+    cr_assert_eq(n.positive, true);
+}
+
+/*
+ * bstd_wide_subtract
+ */
+
+Test(wideutils_tests, wide_subtract__negative_result){
+
+    // given a signed wide number...
+    bstd_wide_number n;
+    n.isSigned = true;
+    n.length = 33;
+    n.scale = 2;
+    n.positive = true;
+    n.value = 100;
+
+    bstd_wide_number m;
+    m.isSigned = false;
+    m.length = 5;
+    m.scale = 3;
+    m.positive = true;
+    m.value = 2500;
+
+    // ... when we subtract a larger number of a different scale...
+    bstd_wide_subtract(&n, &m);
+
+    // ... then the result must be negative.
+    cr_assert(n.value == 150);
+    cr_assert_eq(n.positive, false);
+}
+
+Test(wideutils_tests, wide_subtract__at_digit_limit){
+
+    // given a PIC S9(38) number holding the largest 38-digit value...
+    bstd_wide_number n;
+    n.isSigned = true;
+    n.length = 38;
+    n.scale = 0;
+    n.positive = true;
+    n.value = (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999999ULL;
+
+    bstd_wide_number m = n;
+    m.positive = false;
+
+    // ... when we subtract its negation...
+    bstd_wide_subtract(&n, &m);
+
+    // ... then the difference must be cropped to its 38 low-order digits.
+    cr_assert(n.value == (unsigned __int128) 9999999999999999999ULL * 10000000000000000000ULL + 9999999999999999998ULL);
+    cr_assert_eq(n.positive, true);
+}
+
+/*
+ * bstd_wide_compare
+ */
+
+Test(wideutils_tests, wide_compare__differing_scales){
+
+    // given two wide numbers that differ only in their fractions...
+    bstd_wide_number n;
+    n.isSigned = true;
+    n.length = 33;
+    n.scale = 2;
+    n.positive = true;
+    n.value = 120;
+
+    bstd_wide_number m;
+    m.isSigned = true;
+    m.length = 33;
+    m.scale = 1;
+    m.positive = true;
+    m.value = 19;
+
+    // ... then the comparison must take the fractions into account...
+    cr_assert_eq(bstd_wide_compare(&n, &m), -1);
+    cr_assert_eq(bstd_wide_less_than(&n, &m), true);
+    cr_assert_eq(bstd_wide_greater_than(&m, &n), true);
+
+    // ... and numbers of the same value must be equal regardless of their scales.
+    m.value = 12;
+    cr_assert_eq(bstd_wide_equals(&n, &m), true);
+}
+
+/*
+ * bstd_wide_to_cstr
+ */
+
+Test(wideutils_tests, wide_to_cstr__integer){
+
+    bstd_wide_number n;
+    n.isSigned = true;
+    n.length = 38;
+    n.scale = 0;
+    n.positive = false;
+    n.value = (unsigned __int128) 12345678901234567 * 10000000000000000000ULL + 8901234567890123456ULL;
+
+    char* str = bstd_wide_to_cstr(&n);
+
+    cr_assert_str_eq(str, "-123456789012345678901234567890123456");
+
+    free(str);
+}
+
+Test(wideutils_tests, wide_to_cstr__decimal){
+
+    bstd_wide_number n;
+    n.isSigned = false;
+    n.length = 6;
+    n.scale = 3;
+    n.positive = true;
+    n.value = 1500;
+
+    char* str = bstd_wide_to_cstr(&n);
+
+    cr_assert_str_eq(str, "001.500");
+
+    free(str);
+}
+
+/*
+ * bstd_assign_wide
+ */
+
+Test(wideutils_tests, assign_wide__crops_to_narrow_length){
+
+    bstd_wide_number n;
+    n.isSigned = true;
+    n.length = 33;
+    n.scale = 2;
+    n.positive = false;
+    n.value = (unsigned __int128) 1000000000000000000 * 1000 + 12345;
+
+    bstd_number m;
+    m.isSigned = true;
+    m.length = 7;
+    m.scale = 2;
+    m.positive = true;
+    m.value = 0;
+
+    bstd_assign_wide(&m, &n);
+
+    cr_assert_eq(m.value, 12345);
+    cr_assert_eq(m.positive, false);
+}